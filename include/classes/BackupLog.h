@@ -0,0 +1,46 @@
+#ifndef BackupLog_h
+#define BackupLog_h
+
+#include <Arduino.h>
+#include <I2C_eeprom.h>
+
+#include <config/Constants.h>
+#include <utils/CRC16.h>
+
+struct LogRecord {
+    uint32_t seq;
+    uint32_t journal_seq;
+    uint16_t head_count;
+    uint16_t lock_time;  // longest vault lock hold while flushing the journal [us]
+    uint32_t epoch;  // RTC time of the newest journaled point [s]
+    uint32_t commit_time;  // power loss to committed emergency journal [us]
+    uint8_t closed;
+    uint8_t magic;
+    uint8_t version;
+    uint8_t reserved[7];
+    uint16_t crc;
+};
+
+// Backup headers written round-robin over the EEPROM space left in front of the vault journals
+class BackupLog {
+public:
+    static_assert(sizeof(LogRecord) == LOG_RECORD_SIZE, "Log record layout must match its slot size");
+    static_assert(EEPROM_PAGE_SIZE % LOG_RECORD_SIZE == 0, "Log records must tile EEPROM pages");
+
+    BackupLog(I2C_eeprom& eeprom_ref, uint16_t slots);
+
+    bool scan();
+    void append(LogRecord& record);
+    const LogRecord* getNewest() const;
+
+private:
+    I2C_eeprom& _eeprom;
+    uint16_t _slots;
+    LogRecord _newest;
+    bool _valid = false;
+
+    bool scanAll();
+    bool readRecord(uint16_t slot, LogRecord* record) const;
+};
+
+#endif
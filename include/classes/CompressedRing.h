@@ -0,0 +1,58 @@
+#ifndef CompressedRing_h
+#define CompressedRing_h
+
+#include <Arduino.h>
+
+#include <classes/ExtremaRing.h>
+#include <classes/RingBuffer.h>
+#include <config/Constants.h>
+
+template <typename value_type>
+struct CompressedBlock {
+    value_type first;
+    Extremes<value_type> extremes;
+    uint8_t count;
+    uint16_t bit_count;
+    uint8_t bits[CMPR_SLOT_BYTES];
+};
+
+// Ring of delta-of-delta bit-packed blocks, read through a decoded copy of one block
+template <typename value_type, uint16_t capacity>
+class CompressedRing {
+public:
+    static_assert(sizeof(value_type) <= 2, "Raw escape code holds 16-bit values only");
+
+    // Blocks are counted for the worst measured bit rate, so the capacity is reachable on noisy data too
+    static constexpr uint16_t block_pnts = CMPR_SLOT_BYTES * 8 / CMPR_PNT_BITS;
+    static_assert(block_pnts <= CMPR_BLOCK_LEN, "Worst-case block must not exceed the block length");
+
+    void push(value_type value);
+    void clear();
+
+    value_type operator[](uint16_t index) const;
+    value_type getLast() const;
+    uint16_t getContiguous(uint16_t index, const value_type** items) const;
+    uint16_t getCount() const;
+    bool isFull() const;
+    Extremes<value_type> findExtremes(uint16_t startpoint, uint16_t endpoint) const;
+
+private:
+    RingBuffer<CompressedBlock<value_type>, (capacity + block_pnts - 1) / block_pnts + 1> _blocks;
+    uint16_t _count = 0;  // points held in the blocks, the oldest ones past the capacity are hidden
+    value_type _last = 0;
+    int32_t _last_delta = 0;
+
+    mutable value_type _cache[CMPR_BLOCK_LEN];
+    mutable uint16_t _cache_start = 0;
+    mutable uint8_t _cache_count = 0;
+
+    uint16_t findHidden() const;
+    void cacheBlock(uint16_t index) const;
+    static uint32_t encodePoint(uint32_t zigzag, value_type value, uint8_t* length);
+    static void writeBits(CompressedBlock<value_type>& block, uint32_t code, uint8_t length);
+    static uint32_t readBits(const CompressedBlock<value_type>& block, uint16_t* pos, uint8_t length);
+};
+
+#include <classes/CompressedRing.tpp>
+
+#endif
@@ -4,66 +4,96 @@
 #include <Arduino.h>
 #include <I2C_eeprom.h>
 
-#include <utils/TimeUtils.h>
+#include <classes/CompressedRing.h>
+#include <classes/ExtremaRing.h>
+#include <classes/HistoryPager.h>
+#include <classes/HistoryTier.h>
 #include <config/Constants.h>
 
+// Keeps samples as deci-unit int16_t, the same representation as in EEPROM
 template <typename input_type>
-struct DataPoint {
-    input_type value;
-    uint8_t weekday;
-    uint8_t hour;
-    uint8_t minute;
+struct ScaledStorage {
+    typedef int16_t stored_type;
+    typedef int64_t sum_type;
+    static constexpr float scale = std::is_floating_point<input_type>::value ? 10 : 1;
+    template <uint16_t capacity>
+    using ring_type = ExtremaRing<stored_type, capacity>;
+
+    static stored_type encode(input_type value) {
+        return constrain(round(value * scale), JOURNAL_VOID + 1, INT16_MAX);
+    }
+    static input_type decode(stored_type value) {
+        if constexpr (std::is_floating_point<input_type>::value) return value / scale;
+        else return static_cast<input_type>(value);
+    }
 };
 
-class VaultBase {
-public:
-    virtual void appendToVault(uint8_t wday, uint8_t hour, uint8_t min) = 0;
-    virtual void savePeriodicData(uint16_t* curr_addr) = 0;
-    virtual void saveEmergencyData(uint8_t emergency_data_count) = 0;
-    virtual void restorePointsData(uint16_t* curr_addr, uint16_t st_index,
-                                   uint16_t per_count, uint8_t em_count, uint16_t miss_count) = 0;
-    virtual void assignTimestamps(uint8_t curr_wday, uint8_t curr_hour, uint8_t curr_min) = 0;
-
-    virtual ~VaultBase() {}
+// Keeps samples as received, at the cost of RAM and per-value backup conversion
+template <typename input_type>
+struct PlainStorage {
+    typedef input_type stored_type;
+    typedef double sum_type;
+    static constexpr float scale = 1;
+    template <uint16_t capacity>
+    using ring_type = ExtremaRing<stored_type, capacity>;
+
+    static stored_type encode(input_type value) { return value; }
+    static input_type decode(stored_type value) { return value; }
 };
 
+// Same values as ScaledStorage, delta-of-delta packed for about twice the points per byte on noisy data
 template <typename input_type>
-class DataVault : public VaultBase {
+struct CompressedStorage : ScaledStorage<input_type> {
+    template <uint16_t capacity>
+    using ring_type = CompressedRing<typename ScaledStorage<input_type>::stored_type, capacity>;
+};
+
+template <typename input_type, uint16_t capacity = DATA_PNTS_AMT,
+          typename storage = ScaledStorage<input_type>>
+class DataVault {
 public:
-    DataVault(I2C_eeprom& _eeprom_ptr);
-    DataVault(float slope_norm, I2C_eeprom& eeprom_ptr);
+    typedef typename storage::stored_type stored_type;
+
+    static_assert(capacity > TREND_PNTS_AMT, "Weather prediction period does not fit into stored data");
 
-    void appendToVault(uint8_t wday, uint8_t hour, uint8_t min) override;
+    void appendToVault(uint16_t gap_count = 0);
     void appendToAverage(input_type value);
-    input_type findSampleMax(uint16_t startpoint, uint16_t endpoint) const;
-    input_type findSampleMin(uint16_t startpoint, uint16_t endpoint) const;
-    int8_t findNormalizedTrendSlope(uint8_t period) const;
+    Extremes<stored_type> findSampleExtremes(uint16_t startpoint, uint16_t endpoint,
+                                             tiers tier = RAW_TIER) const;
+    int8_t findNormalizedTrendSlope(float norm_range = 0) const;
+    uint32_t findBackstep(uint16_t index, tiers tier = RAW_TIER) const;
 
-    void savePeriodicData(uint16_t* curr_addr) override;
-    void saveEmergencyData(uint8_t new_data_points) override;
-    void restorePointsData(uint16_t* curr_addr, uint16_t st_index,
-                           uint16_t per_count, uint8_t em_count, uint16_t miss_count) override;
-    void assignTimestamps(uint8_t curr_wday, uint8_t curr_hour, uint8_t curr_min) override;
+    void stageJournal(JournalPage* pages, uint16_t journal_pages, uint32_t seq,
+                      uint16_t new_data_cnt, uint16_t count) const;
+    static void writeJournal(I2C_eeprom& eeprom, uint16_t region_addr, uint16_t journal_pages,
+                             uint32_t seq, const JournalPage* pages, uint16_t count);
+    bool restoreJournal(I2C_eeprom& eeprom, uint16_t region_addr, uint16_t journal_pages,
+                        uint32_t seq, uint16_t head_count, uint16_t miss_count);
 
-    const DataPoint<input_type>* getData() const;
+    input_type getValue(uint16_t index, tiers tier = RAW_TIER) const;
+    stored_type getStoredValue(uint16_t index, tiers tier = RAW_TIER) const;
     input_type getLastValue() const;
-    uint16_t getHeadCount() const;
-    void getCharTime(uint16_t index, char* buffer) const;
+    uint16_t getHeadCount(tiers tier = RAW_TIER) const;
+    static constexpr uint16_t getCapacity();
+    static stored_type decodeJournalPoint(int16_t point);
     static void getCharValue(input_type value, char* buffer, bool forced_round = false);
 
 private:
-    DataPoint<input_type> _data[DATA_PNTS_AMT];
-    I2C_eeprom& _eeprom;
+    typename storage::template ring_type<capacity> _data;
+    // Aggregates are not journaled, a restore rebuilds them from the restored raw points only
+    HistoryTier<stored_type, HOUR_PNTS_AMT, APDS_PER_HOUR> _hours;
+    HistoryTier<stored_type, DAY_PNTS_AMT, 24> _days;
+    typename storage::sum_type _trend_sum_y = 0, _trend_sum_xy = 0;
+    uint8_t _trend_count = 0;
 
-    uint16_t _head_count, _emergency_addr;
     input_type _average_sum = 0;
     uint8_t _average_counter = 0;
-    float _norm_coef = 0;
 
-    void getBytesFromValue(input_type value, uint8_t* bytes) const;
-    input_type getValueFromBytes(uint8_t* bytes) const;
-    uint16_t findStartIndex(uint8_t backstep_time_period) const;
-    int8_t normalizeSlope(float slope) const;
+    void pushPoint(stored_type value);
+    void updateTrendSums(stored_type value);
+    void clearPoints();
+    int16_t findJournalPoint(uint32_t age) const;
+    static int8_t normalizeSlope(float slope, float norm_range);
 };
 
 #include <classes/DataVault.tpp>
@@ -0,0 +1,37 @@
+#ifndef ExtremaRing_h
+#define ExtremaRing_h
+
+#include <Arduino.h>
+
+#include <classes/RingBuffer.h>
+#include <config/Constants.h>
+
+template <typename value_type>
+struct Extremes {
+    value_type max;
+    value_type min;
+};
+
+// Ring buffer with a min/max summary per EXTR_BLOCK_LEN pushed values
+template <typename value_type, uint16_t capacity>
+class ExtremaRing {
+public:
+    void push(value_type value);
+    void clear();
+
+    value_type operator[](uint16_t index) const;
+    value_type getLast() const;
+    uint16_t getContiguous(uint16_t index, const value_type** items) const;
+    uint16_t getCount() const;
+    bool isFull() const;
+    Extremes<value_type> findExtremes(uint16_t startpoint, uint16_t endpoint) const;
+
+private:
+    RingBuffer<value_type, capacity> _values;
+    RingBuffer<Extremes<value_type>, capacity / EXTR_BLOCK_LEN + 2> _blocks;
+    uint32_t _push_count = 0;
+};
+
+#include <classes/ExtremaRing.tpp>
+
+#endif
@@ -3,8 +3,11 @@
 
 #include <Arduino.h>
 #include <Adafruit_ILI9341.h>
+#include <SPI.h>
 
 #include <classes/DataVault.h>
+#include <classes/HistoryPager.h>
+#include <classes/TimeColumn.h>
 #include <config/Constants.h>
 
 class GraphBase {
@@ -14,52 +17,99 @@ public:
     virtual void drawCursor(bool initial = false) = 0;
     virtual void dynamicPan(int8_t step) = 0;
     virtual void dynamicCursor(int8_t step) = 0;
+    virtual bool shiftTier(int8_t step) = 0;
+    virtual void resetTier() = 0;
+    virtual bool setHistory(const HistorySpan& span) = 0;
+    virtual void prefetch() = 0;
     virtual void annotate(bool dayscale = true) = 0;
     virtual void drawLogos(enum screens screen, bool high) = 0;
 
     virtual ~GraphBase() {}
 };
 
-template <typename input_type>
+template <typename input_type, uint16_t capacity = DATA_PNTS_AMT,
+          typename storage = ScaledStorage<input_type>>
 class Graph : public GraphBase {
 public:
-    Graph(DataVault<input_type>& data_ref, Adafruit_ILI9341& tft_ref);
-    ~Graph() override = default;
+    typedef typename storage::stored_type stored_type;
+
+    Graph(DataVault<input_type, capacity, storage>& data_ref, const TimeColumn& time_ref,
+          I2C_eeprom& eeprom_ref, SemaphoreHandle_t bus_lock, const HistorySpan& history,
+          Adafruit_ILI9341& tft_ref, SPIClass& spi_ref);
+    ~Graph() override;
 
     void drawLocal(bool local_sizing = true) override;
     void drawFresh(bool local_sizing = true) override;
     void drawCursor(bool initial = false) override;
     void dynamicPan(int8_t step) override;
     void dynamicCursor(int8_t step) override;
+    bool shiftTier(int8_t step) override;
+    void resetTier() override;
+    bool setHistory(const HistorySpan& span) override;
+    void prefetch() override;
     void annotate(bool dayscale = true) override;
     void drawLogos(enum screens screen, bool high) override;
 
     static uint16_t getTextWidth(const char* string, Adafruit_ILI9341& tft_reference);
 
 private:
-    DataVault<input_type>& _data;
+    DataVault<input_type, capacity, storage>& _data;
+    const TimeColumn& _time;
+    HistoryPager _history;
     Adafruit_ILI9341& _tft;
+    SPIClass& _spi;
 
     // Curve management
+    tiers _tier = RAW_TIER;
     int16_t _curr_startp, _curr_endp;
     uint8_t _curr_level;
     uint8_t _prev_values[TFT_XMAX - L_EDGE];
-    input_type _curr_max, _curr_min;
+    stored_type _curr_max, _curr_min;
+    int32_t _row_scale;
+    int8_t _pan_dir = -1;
 
     void staticGraphCore(int16_t endp, bool local_sizing);
     void updateCurve(bool initial = false);
+    void drawCurveColumn(int16_t x, uint8_t h, int16_t diff);
+
+    // Pixel rows of the points last drawn, kept by index so panning maps only newly exposed points
+    uint8_t _row_cache[TFT_XMAX - L_EDGE];
+    int16_t _cached_startp = 0, _cached_endp = -1;
+    uint32_t _cached_epoch = 0;
+    uint8_t findCurveRow(int16_t index);
+    uint8_t findPixelRow(stored_type value) const;
     void updateAxises(bool initial = false);
+    Timestamp findTimestamp(uint16_t index) const;
+    uint32_t findEpochMinute(uint16_t index) const;
+
+    // Raw tier indexes count the paged journal history first, then the RAM ring
+    uint16_t findHeadCount() const;
+    uint16_t findDeepCount() const;
+    stored_type findStoredValue(uint16_t index);
+    Extremes<stored_type> findExtremes(uint16_t startpoint, uint16_t endpoint);
+    uint32_t findBackstep(uint16_t index) const;
 
     // Ticks management
     int16_t _tick_posns[24 / TICK_PER];
     void updateTicks(bool initial = false);
 
     // Weekday management
-    uint16_t _separtr_index;
-    uint16_t _spot_posns[2];
+    bool _dayscale = false;
+    int16_t _separtr_index;
+    int16_t _spot_posns[2];
     uint8_t _spot_lengths[2];
     void updateWeekdays(bool initial = false);
 
+    // Hardware scrolling, the plot columns rotate in display memory instead of being redrawn
+    bool _scrolled = false;
+    uint16_t _scroll_start = 0;
+    void scrollCurve(int16_t shift);
+    void resetScroll();
+    void drawScrolledColumn(int16_t x);
+    int16_t findScrolledX(int16_t x) const;
+    void fillScrolledRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    void printScrolled(int16_t x, int16_t y, const char* text, uint8_t len, const GFXfont* font, uint16_t color);
+
     // Cursor management
     int16_t _curr_index, _prev_index;
     uint16_t _cursor_x;
@@ -68,11 +118,16 @@ private:
     void drawCursorPointer();
     void drawCursorData();
     void erasePrevCursor();
-    void eraseCursorRect();
-    void eraseCursorLine();
+    void eraseCursorPointer();
     void eraseCursorData();
 
+    // Plot pixels under the cursor pointer, restored in one block each when it moves
+    uint16_t _rect_under[CRECT_SIDE * CRECT_SIDE];
+    uint16_t _line_under[BT_EDGE - UP_EDGE + CRECT_SIDE];
+
     // Auxiliary
+    uint16_t findWireColor(int16_t x, int16_t y) const;
+    void writeBlock(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t* pixels);
     void findAxisLevel();
     float mapFloat(float x, float in_min, float in_max, float out_min, float out_max);
     uint16_t findDataEdge();
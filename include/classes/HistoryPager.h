@@ -0,0 +1,53 @@
+#ifndef HistoryPager_h
+#define HistoryPager_h
+
+#include <Arduino.h>
+#include <I2C_eeprom.h>
+#include <STM32FreeRTOS.h>
+
+#include <classes/ExtremaRing.h>
+#include <config/Constants.h>
+#include <utils/CRC16.h>
+
+// One EEPROM page of journal slots, checksummed so a torn page write is caught on restore
+struct JournalPage {
+    int16_t points[JOURNAL_PAGE_PNTS];
+    uint16_t crc;
+};
+static_assert(sizeof(JournalPage) == EEPROM_PAGE_SIZE, "Journal pages must match EEPROM pages");
+
+// Journaled points older than a vault's RAM ring, oldest first, the ring continues at first_seq + count
+struct HistorySpan {
+    uint16_t region_addr;
+    uint16_t journal_pages;
+    uint32_t first_seq;
+    uint16_t count;
+    const Extremes<int16_t>* page_extremes;  // per region page, min is JOURNAL_VOID until indexed
+};
+
+// Reads evicted history back from a vault journal through a small page cache
+class HistoryPager {
+public:
+    HistoryPager(I2C_eeprom& eeprom_ref, SemaphoreHandle_t bus_lock, const HistorySpan& span);
+
+    int16_t getPoint(uint16_t index);
+    Extremes<int16_t> findExtremes(uint16_t startpoint, uint16_t endpoint);
+    void prefetch(uint16_t index);
+    void setSpan(const HistorySpan& span);
+    uint32_t getFirstSeq() const;
+    uint16_t getCount() const;
+    static Extremes<int16_t> findPageExtremes(const JournalPage& page);
+
+private:
+    I2C_eeprom& _eeprom;
+    SemaphoreHandle_t _bus_lock;
+    HistorySpan _span;
+
+    JournalPage _cache[HIST_CACHE_PAGES];
+    uint32_t _cached_pages[HIST_CACHE_PAGES];
+    int16_t _last_point = 0;
+
+    const JournalPage* loadPage(uint32_t seq_page);
+};
+
+#endif
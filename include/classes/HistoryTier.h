@@ -0,0 +1,40 @@
+#ifndef HistoryTier_h
+#define HistoryTier_h
+
+#include <Arduino.h>
+
+#include <classes/ExtremaRing.h>
+#include <classes/RingBuffer.h>
+
+template <typename value_type>
+struct Aggregate {
+    value_type min;
+    value_type avg;
+    value_type max;
+};
+
+// Ring of min/avg/max aggregates, each closed after bucket_len accumulated samples
+template <typename value_type, uint16_t capacity, uint8_t bucket_len>
+class HistoryTier {
+public:
+    bool accumulate(const Aggregate<value_type>& sample);
+    void clear();
+
+    Aggregate<value_type> getLast() const;
+    value_type getAverage(uint16_t index) const;
+    Extremes<value_type> findExtremes(uint16_t startpoint, uint16_t endpoint) const;
+    uint16_t getCount() const;
+    uint8_t getPending() const;
+
+private:
+    ExtremaRing<value_type, capacity> _mins, _maxs;
+    RingBuffer<value_type, capacity> _avgs;
+
+    Aggregate<value_type> _bucket;
+    float _bucket_sum = 0;
+    uint8_t _bucket_count = 0;
+};
+
+#include <classes/HistoryTier.tpp>
+
+#endif
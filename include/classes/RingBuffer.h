@@ -0,0 +1,29 @@
+#ifndef RingBuffer_h
+#define RingBuffer_h
+
+#include <Arduino.h>
+
+template <typename item_type, uint16_t capacity>
+class RingBuffer {
+public:
+    void push(const item_type& item);
+    void clear();
+
+    item_type& operator[](uint16_t index);
+    const item_type& operator[](uint16_t index) const;
+    const item_type& getLast() const;
+    uint16_t getContiguous(uint16_t index, const item_type** items) const;
+    uint16_t getCount() const;
+    bool isFull() const;
+
+private:
+    item_type _items[capacity];
+    uint16_t _head = 0, _tail = 0;
+    uint16_t _count = 0;
+
+    uint16_t toSlot(uint16_t index) const;
+};
+
+#include <classes/RingBuffer.tpp>
+
+#endif
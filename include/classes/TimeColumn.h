@@ -0,0 +1,30 @@
+#ifndef TimeColumn_h
+#define TimeColumn_h
+
+#include <Arduino.h>
+
+#include <config/Constants.h>
+
+struct Timestamp {
+    uint8_t weekday;
+    uint8_t hour;
+    uint8_t minute;
+};
+
+// Timestamps shared by every vault of a set, counted back in minutes from the newest point's epoch
+class TimeColumn {
+public:
+    void append(uint32_t epoch, uint16_t count = 1);
+    void restore(uint16_t count, uint32_t epoch);
+
+    Timestamp getTimestamp(uint32_t backstep) const;
+    uint32_t getCount() const;
+    uint32_t getEpoch() const;
+    void getCharTime(uint32_t backstep, char* buffer) const;
+
+private:
+    uint32_t _append_count = 0;
+    uint32_t _last_epoch = 0;
+};
+
+#endif
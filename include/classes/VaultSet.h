@@ -0,0 +1,69 @@
+#ifndef VaultSet_h
+#define VaultSet_h
+
+#include <Arduino.h>
+#include <I2C_eeprom.h>
+#include <tuple>
+
+#include <classes/DataVault.h>
+#include <classes/TimeColumn.h>
+
+template <typename... vault_types>
+class VaultSet {
+public:
+    template <typename vault_type>
+    using append = VaultSet<vault_types..., vault_type>;
+
+    // Pending journal chunk copied out under the vault lock and written to EEPROM after releasing it
+    struct JournalStage {
+        uint32_t seq;
+        uint32_t epoch;
+        uint16_t count;
+        uint16_t head_count;
+        JournalPage pages[sizeof...(vault_types)][2];
+    };
+
+    VaultSet(I2C_eeprom& eeprom_ref);
+
+    void appendToVaults(uint32_t epoch);
+    bool stageJournal(JournalStage& stage) const;
+    void writeJournal(const JournalStage& stage) const;
+    void commitJournal(const JournalStage& stage);
+    bool restoreVault(uint8_t channel, uint32_t seq, uint16_t head_count, uint16_t miss_count);
+    void finishRestore(uint32_t seq, uint32_t epoch, uint16_t miss_count);
+    void indexJournalPage(uint16_t page);
+    HistorySpan findHistorySpan(uint8_t channel) const;
+
+    template <uint8_t channel>
+    auto& getVault();
+    template <typename visitor_type>
+    void visitVault(uint8_t channel, visitor_type visitor);
+    const JournalStage* getEmergencyPayload() const;
+    const TimeColumn& getTime() const;
+    uint16_t getHeadCount() const;
+    static constexpr uint8_t getVaultCount();
+    static constexpr uint16_t getCapacity();
+    static constexpr uint16_t getJournalAddr();
+    static constexpr uint16_t findJournalPages(uint16_t capacity);
+    static constexpr float findEnduranceYears();
+    static constexpr uint16_t findEmergencyCommitTime();
+
+private:
+    std::tuple<vault_types...> _vaults;
+    TimeColumn _time;
+    uint32_t _journal_seq = 0;
+    uint16_t _journal_pending = 0;
+    uint16_t _gap_count = 0;
+    JournalStage _emergency;
+    volatile bool _emergency_ready = false;
+    I2C_eeprom& _eeprom;
+
+    // Min and max of every journal page, lets deep history autoscale without reading EEPROM
+    Extremes<int16_t> _page_extremes[JOURNAL_PAGES];
+
+    void restageEmergency();
+};
+
+#include <classes/VaultSet.tpp>
+
+#endif
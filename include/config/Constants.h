@@ -12,7 +12,9 @@
 
 // ==================== SETTINGS ====================
 
-#define DATA_PNTS_AMT 1200  // amount of stored data points
+#define DATA_PNTS_AMT 1200  // default amount of stored data points per vault
+#define HOUR_PNTS_AMT 720  // amount of hourly aggregates kept in RAM, not backed up
+#define DAY_PNTS_AMT 180  // amount of daily aggregates kept in RAM, not backed up
 #define UPD_PER 60000  // indoor sensors polling period [ms]
 #define APD_PER 360000  // period of appending new values to vault [ms]
 #define AWAKE_PER 60000  // display backlight timeout [ms]
@@ -21,12 +23,25 @@
 #define CRSR_SLOW 1  // cursor speed slow [data points/turn]
 #define CRSR_FAST 10  // cursor speed fast [data points/turn]
 #define TICK_PER 6  // graph ticks period [hours]
+#define PAN_SCROLL false  // pan the graph with the display's hardware scrolling
+#define EEPROM_LIFE_YEARS 10  // minimal projected lifetime of the backup EEPROM [years]
+#define HOLDUP_TIME 100  // supply holdup after power loss is detected [ms]
+#define GAP_FILL HOLD_LAST  // points missed while unpowered: HOLD_LAST or INTERPOLATE
 
 #define BACKSTEP_PER 75  // time period used for weather prediction [min]
 #define PRESS_NORM_RANGE 0.01  // highest pressure change [mmHg/min]
 #define HUM_NORM_RANGE 0.5  // highest humidity change [%/min]
 #define TEMP_NORM_RANGE 0.15  // highest temperature change [°C/min]
 
+// sensor channels, one per line in screen order after MAIN: screen, vault, input type, data points, storage
+#define CHANNELS(X)                                                             \
+    X(OUT_TEMP, out_temp, float, DATA_PNTS_AMT, ScaledStorage)                  \
+    X(OUT_HUM, out_hum, float, DATA_PNTS_AMT, ScaledStorage)                    \
+    X(OUT_PRESS, out_press, float, 3 * DATA_PNTS_AMT, CompressedStorage)        \
+    X(IN_TEMP, in_temp, float, DATA_PNTS_AMT, ScaledStorage)                    \
+    X(IN_HUM, in_hum, float, DATA_PNTS_AMT, ScaledStorage)                      \
+    X(CO2_RATE, co2_rate, uint16_t, DATA_PNTS_AMT, ScaledStorage)
+
 #define LONGITUDE 24.75  // station location longitude [degrees]
 #define LONGEST_DAY 18  // day length during summer solstice [hours]
 #define SHORTEST_DAY 6  // day lenght during winter solstice [hours]
@@ -99,8 +114,33 @@
 #define SCREEN_UPD_PER 50
 
 #define ENC_FAST_TIME 150
+#define RAM_SIZE (96 * 1024)
+#define RAM_RESERVE (8 * 1024)
+#define VAULTS_RAM_BUDGET (RAM_SIZE - configTOTAL_HEAP_SIZE - HEAP_SIZE - RAM_RESERVE)
+#define EEPROM_SIZE 32768
+#define EEPROM_ENDURANCE 1000000
+#define EEPROM_PAGE_SIZE 64
+#define EEPROM_WRITE_TIME 7
+#define I2C_CLOCK 400000
+#define LOG_RECORD_SIZE 32
+#define LOG_SLOTS 128
+#define LOG_MAGIC 0xA5
+#define LOG_VERSION 6
+#define EXTR_BLOCK_LEN 32
+#define CMPR_BLOCK_LEN 64
+#define CMPR_SLOT_BYTES 24
+// test_compression_bench measures up to 6 bits per point on pressure. Sizing for that, 3x raw depth
+// (about 1.9x points per byte) is the measured limit, a 4x ring would not fill on noisy pressure
+#define CMPR_PNT_BITS 6  // worst sustained bits per point measured on noisy and drifting pressure
+#define STAGE_PNTS_AMT (STORE_PER / APD_PER)
+#define JOURNAL_PAGE_PNTS ((EEPROM_PAGE_SIZE >> 1) - 1)
+#define JOURNAL_VOID INT16_MIN
+#define JOURNAL_PAGES ((EEPROM_SIZE - LOG_SLOTS * LOG_RECORD_SIZE) / EEPROM_PAGE_SIZE)
+#define HIST_CACHE_PAGES 12
 #define APD_PER_S (APD_PER / 60000)
-#define BYTES_PER_HOUR ((STORE_PER / APD_PER) << 1)
+#define APDS_PER_HOUR (3600000 / APD_PER)
+#define TIER_PER_S(tier) ((tier) == DAY_TIER ? 24 * 60 : (tier) == HOUR_TIER ? 60 : APD_PER_S)
+#define TREND_PNTS_AMT ((BACKSTEP_PER + APD_PER_S - 1) / APD_PER_S + 1)
 
 #define TFT_XMAX 320
 #define TFT_YMAX 240
@@ -179,15 +219,6 @@ const char weekdays[7][12] = {
 const uint8_t days_in_month[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
 
 
-// ===================== MACROS =====================
-
-#define SAVE_BACKUP_STATE(ready) (eeprom.writeByte(0, (ready)))
-#define READ_BACKUP_STATE()      (eeprom.readByte(0))
-#define STORE_BYTES(array, index, bytes) \
-    (array)[(index) << 1] = (bytes)[0]; \
-    (array)[((index) << 1) + 1] = (bytes)[1];
-
-
 // =================== EXCEPTIONS ===================
 
 #if (TICK_PER < 4 || 24 % TICK_PER != 0)
@@ -198,8 +229,12 @@ const uint8_t days_in_month[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}
 #error "Only whole number of appends should fit into storage period"
 #endif
 
-#if (DATA_PNTS_AMT > 1200)
-#warning "Stack overflow risk due to statically filled RAM"
+#if (3600000 % APD_PER != 0)
+#error "Only whole number of appends should fit into an hour"
+#endif
+
+#if (TREND_PNTS_AMT > 255)
+#error "Weather prediction period does not fit into stored data"
 #endif
 
 #endif
\ No newline at end of file
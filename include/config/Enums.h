@@ -16,6 +16,17 @@ enum screens {
     CO2_RATE
 };
 
+enum tiers {
+    RAW_TIER,
+    HOUR_TIER,
+    DAY_TIER
+};
+
+enum gap_fills {
+    HOLD_LAST,
+    INTERPOLATE
+};
+
 enum conn_statuses {
     RECEIVING,
     PENDING,
@@ -7,8 +7,10 @@
 #include <Wire.h>
 
 #include <config/Constants.h>
+#include <classes/BackupLog.h>
 #include <classes/GraphingEngine.h>
 #include <classes/DataVault.h>
+#include <classes/VaultSet.h>
 #include <utils/BME280.h>
 #include <utils/MHZ19B.h>
 #include <utils/SolarWeatherUtils.h>
@@ -30,24 +32,22 @@ extern MHZ19B mhz;
 extern EncButton enc;
 extern RF24 radio;
 extern I2C_eeprom eeprom;
+extern BackupLog backup_log;
 extern STM32RTC& rtc;
 
-extern DataVault <float> out_temp;
-extern DataVault <float> out_hum;
-extern DataVault <float> out_press;
-extern DataVault <float> in_temp;
-extern DataVault <float> in_hum;
-extern DataVault <uint16_t> co2_rate;
+#define CHANNEL_TYPE(screen, vault, type, points, storage) ::append<DataVault<type, points, storage<type>>>
+#define CHANNEL_EXTERN(screen, vault, type, points, storage) extern DataVault<type, points, storage<type>>& vault;
+typedef VaultSet<> CHANNELS(CHANNEL_TYPE) station_vaults;
 
-extern GraphBase* plot;
-extern VaultBase* vaults[6];
+extern station_vaults vaults;
+CHANNELS(CHANNEL_EXTERN)
 
-extern uint16_t last_day_min;
-extern bool backup_ready;
+extern GraphBase* plot;
 
 extern state_config state;
 extern SemaphoreHandle_t enc_event, enc_release;
-extern SemaphoreHandle_t state_lock, vault_lock;
+extern SemaphoreHandle_t state_lock, vault_lock, i2c_lock, restore_done;
 extern TaskHandle_t tasks[NUM_TASKS];
+extern volatile uint32_t power_fail_time;
 
 #endif
\ No newline at end of file
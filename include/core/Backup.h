@@ -2,15 +2,16 @@
 #define Backup_h
 
 #include <Arduino.h>
+#include <config/Globals.h>
 
-void saveInt(uint16_t value, uint16_t* addr);
-uint16_t readInt(uint16_t* addr);
-
+void appendLogRecord(LogRecord& record, bool closed);
+uint16_t flushJournal(station_vaults::JournalStage& stage);
 void createRawBackup();
 void finalizeBackup();
 
 void pullBackup();
-void restoreAuxiliaryData(uint16_t &addr, uint32_t &elapsed_time, uint16_t &periodic_cnt,
-                          uint8_t &emergency_cnt, uint16_t &missing_cnt, uint16_t &start_index);
+void awaitRestore();
+void restoreAuxiliaryData(const LogRecord& record, uint32_t &elapsed_time, uint16_t &missing_cnt,
+                          uint32_t &restore_epoch);
 
 #endif
\ No newline at end of file
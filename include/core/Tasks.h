@@ -9,6 +9,7 @@ void pollRTCEvents(void*);
 
 void emergencyBackup(void*);
 void periodicBackup(void*);
+void restoreBackup(void*);
 
 void dataAppend(void*);
 void dataUpdate(void*);
@@ -0,0 +1,8 @@
+#ifndef CRC16_h
+#define CRC16_h
+
+#include <Arduino.h>
+
+uint16_t findCRC16(const void* data, uint16_t length, uint16_t crc = 0xFFFF);
+
+#endif
@@ -0,0 +1,56 @@
+#include <classes/BackupLog.h>
+
+BackupLog::BackupLog(I2C_eeprom& eeprom_ref, uint16_t slots)
+    : _eeprom(eeprom_ref), _slots(slots) {}
+
+bool BackupLog::scan() {
+    _valid = readRecord(0, &_newest);
+    if (!_valid) return scanAll();
+
+    // Slots hold consecutive sequence numbers up to the newest one, older laps follow
+    uint16_t low = 0, high = _slots - 1;
+    while (low < high) {
+        uint16_t mid = (low + high + 1) >> 1;
+        LogRecord record;
+        if (readRecord(mid, &record) && record.seq == _newest.seq + (mid - low)) {
+            _newest = record;
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return true;
+}
+
+void BackupLog::append(LogRecord& record) {
+    record.seq = _valid ? _newest.seq + 1 : 0;
+    record.magic = LOG_MAGIC;
+    record.version = LOG_VERSION;
+    record.crc = findCRC16(&record, offsetof(LogRecord, crc));
+    _eeprom.writeBlock((record.seq % _slots) * LOG_RECORD_SIZE,
+                       reinterpret_cast<const uint8_t*>(&record), LOG_RECORD_SIZE);
+    _newest = record;
+    _valid = true;
+}
+
+bool BackupLog::scanAll() {
+    // A torn write of slot 0 after a wrap leaves the newest intact record anywhere behind it
+    LogRecord record;
+    for (uint16_t slot = 1; slot < _slots; slot++) {
+        if (readRecord(slot, &record) && (!_valid || record.seq > _newest.seq)) {
+            _newest = record;
+            _valid = true;
+        }
+    }
+    return _valid;
+}
+
+const LogRecord* BackupLog::getNewest() const {
+    return _valid ? &_newest : nullptr;
+}
+
+bool BackupLog::readRecord(uint16_t slot, LogRecord* record) const {
+    _eeprom.readBlock(slot * LOG_RECORD_SIZE, reinterpret_cast<uint8_t*>(record), LOG_RECORD_SIZE);
+    return record->magic == LOG_MAGIC && record->version == LOG_VERSION
+           && record->crc == findCRC16(record, offsetof(LogRecord, crc));
+}
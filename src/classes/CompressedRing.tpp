@@ -0,0 +1,184 @@
+template <typename value_type, uint16_t capacity>
+void CompressedRing<value_type, capacity>::push(value_type value) {
+    _cache_count = 0;
+
+    if (_count && _blocks.getLast().count < CMPR_BLOCK_LEN) {
+        CompressedBlock<value_type>& block = _blocks[_blocks.getCount() - 1];
+        int32_t delta = (int32_t) value - _last;
+        int32_t dod = delta - _last_delta;
+        uint8_t length;
+        uint32_t code = encodePoint(((uint32_t) dod << 1) ^ (uint32_t) (dod >> 31), value, &length);
+
+        if (block.bit_count + length <= CMPR_SLOT_BYTES * 8) {
+            writeBits(block, code, length);
+            block.extremes.max = max(block.extremes.max, value);
+            block.extremes.min = min(block.extremes.min, value);
+            block.count++;
+
+            _last = value;
+            _last_delta = delta;
+            _count++;
+            return;
+        }
+    }
+
+    if (_blocks.isFull()) _count -= _blocks[0].count;
+    CompressedBlock<value_type> block = {};
+    block.first = value;
+    block.extremes = {value, value};
+    block.count = 1;
+    _blocks.push(block);
+
+    _last = value;
+    _last_delta = 0;
+    _count++;
+}
+
+template <typename value_type, uint16_t capacity>
+void CompressedRing<value_type, capacity>::clear() {
+    _blocks.clear();
+    _count = 0;
+    _last = 0;
+    _last_delta = 0;
+    _cache_count = 0;
+}
+
+template <typename value_type, uint16_t capacity>
+value_type CompressedRing<value_type, capacity>::operator[](uint16_t index) const {
+    index += findHidden();
+    cacheBlock(index);
+    return _cache[index - _cache_start];
+}
+
+template <typename value_type, uint16_t capacity>
+value_type CompressedRing<value_type, capacity>::getLast() const {
+    return _last;
+}
+
+template <typename value_type, uint16_t capacity>
+uint16_t CompressedRing<value_type, capacity>::getContiguous(uint16_t index, const value_type** items) const {
+    index += findHidden();
+    cacheBlock(index);
+    *items = &_cache[index - _cache_start];
+    return _cache_start + _cache_count - index;
+}
+
+template <typename value_type, uint16_t capacity>
+uint16_t CompressedRing<value_type, capacity>::getCount() const {
+    return min(_count, capacity);
+}
+
+template <typename value_type, uint16_t capacity>
+bool CompressedRing<value_type, capacity>::isFull() const {
+    return _count >= capacity;
+}
+
+template <typename value_type, uint16_t capacity>
+Extremes<value_type> CompressedRing<value_type, capacity>::findExtremes(uint16_t startpoint,
+                                                                       uint16_t endpoint) const {
+    value_type first = (*this)[startpoint];
+    startpoint += findHidden();
+    endpoint += findHidden();
+    Extremes<value_type> result = {first, first};
+    uint16_t block_start = 0;
+
+    for (uint16_t i = 0; i < _blocks.getCount() && block_start <= endpoint; i++) {
+        const CompressedBlock<value_type>& block = _blocks[i];
+        uint16_t block_end = block_start + block.count - 1;
+
+        if (block_start >= startpoint && block_end <= endpoint) {
+            result.max = max(result.max, block.extremes.max);
+            result.min = min(result.min, block.extremes.min);
+        } else if (block_end >= startpoint) {
+            uint16_t last = min(block_end, endpoint);
+            for (uint16_t j = max(block_start, startpoint); j <= last; j++) {
+                cacheBlock(j);
+                value_type value = _cache[j - _cache_start];
+                result.max = max(result.max, value);
+                result.min = min(result.min, value);
+            }
+        }
+        block_start += block.count;
+    }
+    return result;
+}
+
+template <typename value_type, uint16_t capacity>
+uint16_t CompressedRing<value_type, capacity>::findHidden() const {
+    return _count - getCount();
+}
+
+template <typename value_type, uint16_t capacity>
+void CompressedRing<value_type, capacity>::cacheBlock(uint16_t index) const {
+    if (_cache_count && index >= _cache_start && index < _cache_start + _cache_count) return;
+
+    uint16_t block_start = 0, i = 0;
+    while (index >= block_start + _blocks[i].count) {
+        block_start += _blocks[i].count;
+        i++;
+    }
+    const CompressedBlock<value_type>& block = _blocks[i];
+
+    int32_t value = block.first, delta = 0;
+    uint16_t pos = 0;
+    _cache[0] = value;
+    for (uint8_t j = 1; j < block.count; j++) {
+        uint32_t zigzag;
+        if (!readBits(block, &pos, 1)) zigzag = 0;
+        else if (!readBits(block, &pos, 1)) zigzag = readBits(block, &pos, 3);
+        else if (!readBits(block, &pos, 1)) zigzag = readBits(block, &pos, 6);
+        else if (!readBits(block, &pos, 1)) zigzag = readBits(block, &pos, 12);
+        else {
+            int32_t raw = (int16_t) readBits(block, &pos, 16);
+            delta = raw - value;
+            value = raw;
+            _cache[j] = value;
+            continue;
+        }
+        delta += (int32_t) (zigzag >> 1) ^ -(int32_t) (zigzag & 1);
+        value += delta;
+        _cache[j] = value;
+    }
+    _cache_start = block_start;
+    _cache_count = block.count;
+}
+
+template <typename value_type, uint16_t capacity>
+uint32_t CompressedRing<value_type, capacity>::encodePoint(uint32_t zigzag, value_type value,
+                                                           uint8_t* length) {
+    if (zigzag == 0) {
+        *length = 1;
+        return 0;
+    } else if (zigzag < (1 << 3)) {
+        *length = 5;
+        return (0b10 << 3) | zigzag;
+    } else if (zigzag < (1 << 6)) {
+        *length = 9;
+        return (0b110 << 6) | zigzag;
+    } else if (zigzag < (1 << 12)) {
+        *length = 16;
+        return (0b1110 << 12) | zigzag;
+    }
+    *length = 20;
+    return (0b1111UL << 16) | (uint16_t) value;
+}
+
+template <typename value_type, uint16_t capacity>
+void CompressedRing<value_type, capacity>::writeBits(CompressedBlock<value_type>& block,
+                                                     uint32_t code, uint8_t length) {
+    while (length--) {
+        if ((code >> length) & 1) block.bits[block.bit_count >> 3] |= 0x80 >> (block.bit_count & 7);
+        block.bit_count++;
+    }
+}
+
+template <typename value_type, uint16_t capacity>
+uint32_t CompressedRing<value_type, capacity>::readBits(const CompressedBlock<value_type>& block,
+                                                        uint16_t* pos, uint8_t length) {
+    uint32_t result = 0;
+    while (length--) {
+        result = (result << 1) | ((block.bits[*pos >> 3] >> (7 - (*pos & 7))) & 1);
+        (*pos)++;
+    }
+    return result;
+}
@@ -1,13 +1,5 @@
-template <typename input_type>
-DataVault<input_type>::DataVault(I2C_eeprom& eeprom_ref) 
-    : _eeprom(eeprom_ref) {}
-
-template <typename input_type>
-DataVault<input_type>::DataVault(float slope_norm, I2C_eeprom& eeprom_ref) 
-    : _norm_coef(slope_norm), _eeprom(eeprom_ref) {}
-
-template <typename input_type>
-void DataVault<input_type>::appendToVault(uint8_t wday, uint8_t hour, uint8_t min) {
+template <typename input_type, uint16_t capacity, typename storage>
+void DataVault<input_type, capacity, storage>::appendToVault(uint16_t gap_count) {
     input_type value;
     if constexpr (std::is_integral<input_type>::value) {
         value = round((float) _average_sum / _average_counter);
@@ -17,177 +9,171 @@ void DataVault<input_type>::appendToVault(uint8_t wday, uint8_t hour, uint8_t mi
     _average_sum = value;
     _average_counter = 1;
 
-    if (_head_count < DATA_PNTS_AMT) {
-        _data[_head_count] = {value, wday, hour, min};
-        _head_count++;
-    } else {
-        for (uint16_t i = 1; i < DATA_PNTS_AMT; i++) {
-            _data[i - 1] = _data[i];
+    stored_type point = storage::encode(value);
+    if (gap_count && _data.getCount()) {
+        stored_type last_point = _data.getLast();
+        for (uint16_t i = 1; i <= gap_count; i++) {
+            if constexpr (GAP_FILL == INTERPOLATE) {
+                pushPoint(last_point + (point - last_point) * i / (gap_count + 1));
+            } else {
+                pushPoint(last_point);
+            }
         }
-        _data[DATA_PNTS_AMT - 1] = {value, wday, hour, min};
     }
+    pushPoint(point);
 }
 
-template <typename input_type>
-void DataVault<input_type>::appendToAverage(input_type value) {
+template <typename input_type, uint16_t capacity, typename storage>
+void DataVault<input_type, capacity, storage>::appendToAverage(input_type value) {
     _average_sum += value;
     _average_counter++;
 }
 
-template <typename input_type>
-input_type DataVault<input_type>::findSampleMax(uint16_t startpoint, uint16_t endpoint) const {
-    input_type max_value = _data[startpoint].value;
-    for (uint16_t i = startpoint + 1; i <= endpoint; i++) {
-        max_value = max(max_value, _data[i].value);
+template <typename input_type, uint16_t capacity, typename storage>
+Extremes<typename storage::stored_type>
+DataVault<input_type, capacity, storage>::findSampleExtremes(uint16_t startpoint, uint16_t endpoint,
+                                                             tiers tier) const {
+    switch (tier) {
+        case HOUR_TIER: return _hours.findExtremes(startpoint, endpoint);
+        case DAY_TIER: return _days.findExtremes(startpoint, endpoint);
+        default: return _data.findExtremes(startpoint, endpoint);
     }
-    return max_value;
 }
 
-template <typename input_type>
-input_type DataVault<input_type>::findSampleMin(uint16_t startpoint, uint16_t endpoint) const {
-    input_type min_value = _data[startpoint].value;
-    for (uint16_t i = startpoint + 1; i <= endpoint; i++) {
-        min_value = min(min_value, _data[i].value);
-    }
-    return min_value;
-}
-
-template <typename input_type>
-int8_t DataVault<input_type>::findNormalizedTrendSlope(uint8_t period) const {
-    if (_head_count == 0) return 0;
-
-    uint16_t start_index = findStartIndex(period);
-    uint16_t start_time = findMinutesOfDay(_data[start_index].hour, _data[start_index].minute);
+template <typename input_type, uint16_t capacity, typename storage>
+int8_t DataVault<input_type, capacity, storage>::findNormalizedTrendSlope(float norm_range) const {
+    if (_trend_count == 0) return 0;
 
-    float sum_x = 0, sum_y = 0, sum_xy = 0, sum_x2 = 0;
-    uint8_t n = _head_count - start_index;
-    for (uint16_t i = start_index; i < _head_count; ++i) {
-        uint16_t point_time = findMinutesOfDay(_data[i].hour, _data[i].minute);
+    typedef typename storage::sum_type sum_type;
+    uint8_t n = _trend_count;
+    sum_type sum_x = (n * (n - 1)) >> 1;
+    sum_type sum_x2 = (n * (n - 1) * (2 * n - 1)) / 6;
 
-        float y = _data[i].value;
-        uint16_t x = findDayMinutesDifference(point_time, start_time);
-        sum_x += x; sum_y += y;
-        sum_xy += x * y; sum_x2 += x * x;
-    }
-
-    float numerator = n * sum_xy - sum_x * sum_y;
-    float denominator = n * sum_x2 - sum_x * sum_x;
-    float slope = (denominator == 0) ? 0 : numerator / denominator;
+    sum_type numerator = n * _trend_sum_xy - sum_x * _trend_sum_y;
+    sum_type denominator = n * sum_x2 - sum_x * sum_x;
+    float slope = (denominator == 0) ? 0
+                : (float) numerator / (denominator * APD_PER_S * storage::scale);
 
-    return (_norm_coef != 0) ? normalizeSlope(slope) : slope;
+    return (norm_range != 0) ? normalizeSlope(slope, norm_range) : slope;
 }
 
-template <typename input_type>
-void DataVault<input_type>::savePeriodicData(uint16_t* curr_addr) {
-    uint16_t data_len = _head_count << 1;
-    uint8_t data_arr[data_len];
+template <typename input_type, uint16_t capacity, typename storage>
+void DataVault<input_type, capacity, storage>::stageJournal(JournalPage* pages, uint16_t journal_pages,
+                                                            uint32_t seq, uint16_t new_data_cnt,
+                                                            uint16_t count) const {
+    if (!count) return;
+    uint16_t slots = journal_pages * JOURNAL_PAGE_PNTS;
+    uint32_t chunk_end = seq + count;
+    uint16_t page = (seq % slots) / JOURNAL_PAGE_PNTS;
+    uint16_t last_page = ((chunk_end - 1) % slots) / JOURNAL_PAGE_PNTS;
 
-    for (uint16_t i = 0; i < _head_count; i++) {
-        uint8_t bytes[2];
-        getBytesFromValue(_data[i].value, bytes);
-        STORE_BYTES(data_arr, i, bytes);
+    // Whole pages are staged, each slot holding its newest journal point up to the chunk end
+    for (;;) {
+        for (uint16_t i = 0; i < JOURNAL_PAGE_PNTS; i++) {
+            uint16_t slot = page * JOURNAL_PAGE_PNTS + i;
+            uint16_t laps_back = ((chunk_end - 1) % slots + slots - slot) % slots;
+            pages->points[i] = findJournalPoint(new_data_cnt - count + laps_back);
+        }
+        pages->crc = findCRC16(pages->points, sizeof(pages->points));
+        if (page == last_page) break;
+        page = (page + 1) % journal_pages;
+        pages++;
     }
-    _eeprom.writeBlock(*curr_addr, data_arr, data_len);
-    *curr_addr += data_len;
-
-    _emergency_addr = *curr_addr;
-    *curr_addr += BYTES_PER_HOUR;
 }
 
-template <typename input_type>
-void DataVault<input_type>::saveEmergencyData(uint8_t new_data_cnt) {
-    uint16_t data_len = new_data_cnt << 1;
-    uint8_t data_arr[data_len];
-
-    for (uint8_t i = 0; i < new_data_cnt; i++) {
-        uint8_t bytes[2];
-        getBytesFromValue(_data[_head_count - new_data_cnt + i].value, bytes);
-        STORE_BYTES(data_arr, i, bytes);
+template <typename input_type, uint16_t capacity, typename storage>
+void DataVault<input_type, capacity, storage>::writeJournal(I2C_eeprom& eeprom, uint16_t region_addr,
+                                                            uint16_t journal_pages, uint32_t seq,
+                                                            const JournalPage* pages, uint16_t count) {
+    if (!count) return;
+    uint16_t slots = journal_pages * JOURNAL_PAGE_PNTS;
+    uint16_t page = (seq % slots) / JOURNAL_PAGE_PNTS;
+    uint16_t last_page = ((seq + count - 1) % slots) / JOURNAL_PAGE_PNTS;
+
+    for (;;) {
+        eeprom.writeBlock(region_addr + page * EEPROM_PAGE_SIZE, reinterpret_cast<const uint8_t*>(pages),
+                          sizeof(JournalPage));
+        if (page == last_page) break;
+        page = (page + 1) % journal_pages;
+        pages++;
     }
-    _eeprom.writeBlock(_emergency_addr, data_arr, data_len);
 }
 
-template <typename input_type>
-void DataVault<input_type>::restorePointsData(uint16_t* curr_addr, 
-                                              uint16_t st_index, uint16_t per_count,
-                                              uint8_t em_count, uint16_t miss_count) {
-    _head_count = 0;
-    if (st_index < per_count) {
-        uint16_t data_len = per_count << 1;
-        uint8_t periodic_data[data_len];
-        _eeprom.readBlock(*curr_addr, periodic_data, data_len);
-
-        for (uint16_t i = st_index; i < per_count; i++) {
-            _data[_head_count++].value = getValueFromBytes(&periodic_data[i << 1]);
+template <typename input_type, uint16_t capacity, typename storage>
+bool DataVault<input_type, capacity, storage>::restoreJournal(I2C_eeprom& eeprom, uint16_t region_addr,
+                                                              uint16_t journal_pages, uint32_t seq,
+                                                              uint16_t head_count, uint16_t miss_count) {
+    uint16_t slots = journal_pages * JOURNAL_PAGE_PNTS;
+    clearPoints();
+    uint16_t count = min(head_count, capacity);
+    uint32_t total_count = (uint32_t) count + miss_count;
+    uint16_t skip = min((uint32_t) count, (total_count > capacity) ? total_count - capacity : 0);
+    uint16_t slot = (seq - count + skip) % slots;
+    count -= skip;
+
+    // A torn page or a placeholder repeats the last restored point, so the newer points keep their times
+    JournalPage page;
+    while (count) {
+        uint16_t offset = slot % JOURNAL_PAGE_PNTS;
+        uint16_t run = min(count, (uint16_t) (JOURNAL_PAGE_PNTS - offset));
+        eeprom.readBlock(region_addr + (slot / JOURNAL_PAGE_PNTS) * EEPROM_PAGE_SIZE,
+                         reinterpret_cast<uint8_t*>(&page), sizeof(JournalPage));
+        bool intact = findCRC16(page.points, sizeof(page.points)) == page.crc;
+        for (uint16_t i = offset; i < offset + run; i++) {
+            if (intact && page.points[i] != JOURNAL_VOID) pushPoint(decodeJournalPoint(page.points[i]));
+            else if (_data.getCount()) pushPoint(_data.getLast());
         }
-        *curr_addr += data_len;
+        slot = (slot + run) % slots;
+        count -= run;
     }
+    return _data.getCount() != 0;
+}
 
-    if (em_count && st_index < per_count + em_count) {
-        uint16_t data_len = em_count << 1;
-        uint8_t emergency_data[data_len];
-        _eeprom.readBlock(*curr_addr, emergency_data, data_len);
-        st_index = max(st_index - per_count, 0);
-
-        for (uint16_t i = st_index; i < em_count; i++) {
-            _data[_head_count++].value = getValueFromBytes(&emergency_data[i << 1]);
-        }
-    }
+template <typename input_type, uint16_t capacity, typename storage>
+input_type DataVault<input_type, capacity, storage>::getValue(uint16_t index, tiers tier) const {
+    return storage::decode(getStoredValue(index, tier));
+}
 
-    if (miss_count && _head_count) {
-        input_type last_point = _data[_head_count - 1].value;
-        for (uint16_t i = 0; i < miss_count && _head_count < DATA_PNTS_AMT; i++) {
-            _data[_head_count++].value = last_point;
-        }
-    }
-    *curr_addr += BYTES_PER_HOUR;
-}
-
-template <typename input_type>
-void DataVault<input_type>::assignTimestamps(uint8_t curr_wday, uint8_t curr_hour, uint8_t curr_min) {
-    for (int16_t i = _head_count - 1; i >= 0; i--) {
-        _data[i].weekday = curr_wday - 1;
-        _data[i].hour = curr_hour;
-        _data[i].minute = curr_min;
-
-        if (curr_min >= APD_PER_S) {
-            curr_min -= APD_PER_S;
-        } else {
-            uint8_t decrement = APD_PER_S - curr_min;
-            curr_min = 60 - decrement;
-            if (curr_hour > 0) {
-                curr_hour--;
-            } else {
-                curr_hour = 23;
-                curr_wday = (curr_wday > 1) ? curr_wday - 1 : 7;
-            }
-        }
+template <typename input_type, uint16_t capacity, typename storage>
+typename storage::stored_type
+DataVault<input_type, capacity, storage>::getStoredValue(uint16_t index, tiers tier) const {
+    switch (tier) {
+        case HOUR_TIER: return _hours.getAverage(index);
+        case DAY_TIER: return _days.getAverage(index);
+        default: return _data[index];
     }
 }
 
-template <typename input_type>
-const DataPoint<input_type>* DataVault<input_type>::getData() const {
-    return _data;
+template <typename input_type, uint16_t capacity, typename storage>
+input_type DataVault<input_type, capacity, storage>::getLastValue() const {
+    if (_data.getCount() == 0) return 0;
+    return storage::decode(_data.getLast());
 }
 
-template <typename input_type>
-input_type DataVault<input_type>::getLastValue() const {
-    if (_head_count == 0) return 0;
-    return _data[_head_count - 1].value;
+template <typename input_type, uint16_t capacity, typename storage>
+uint16_t DataVault<input_type, capacity, storage>::getHeadCount(tiers tier) const {
+    switch (tier) {
+        case HOUR_TIER: return _hours.getCount();
+        case DAY_TIER: return _days.getCount();
+        default: return _data.getCount();
+    }
 }
 
-template <typename input_type>
-uint16_t DataVault<input_type>::getHeadCount() const {
-    return _head_count;
+template <typename input_type, uint16_t capacity, typename storage>
+constexpr uint16_t DataVault<input_type, capacity, storage>::getCapacity() {
+    return capacity;
 }
 
-template <typename input_type>
-void DataVault<input_type>::getCharTime(uint16_t index, char* buffer) const {
-    sprintf(buffer, "%u:%02u", _data[index].hour, _data[index].minute);
+template <typename input_type, uint16_t capacity, typename storage>
+uint32_t DataVault<input_type, capacity, storage>::findBackstep(uint16_t index, tiers tier) const {
+    uint32_t backstep = (uint32_t) (getHeadCount(tier) - 1 - index) * TIER_PER_S(tier);
+    if (tier != RAW_TIER) backstep += _hours.getPending() * APD_PER_S;
+    if (tier == DAY_TIER) backstep += _days.getPending() * 60;
+    return backstep;
 }
 
-template <typename input_type>
-void DataVault<input_type>::getCharValue(input_type value, char* buffer, bool forced_round) {
+template <typename input_type, uint16_t capacity, typename storage>
+void DataVault<input_type, capacity, storage>::getCharValue(input_type value, char* buffer, bool forced_round) {
     if (forced_round) {
         int16_t rounded_value = static_cast<int>(round(value));
         sprintf(buffer, "%d", rounded_value);
@@ -205,42 +191,58 @@ void DataVault<input_type>::getCharValue(input_type value, char* buffer, bool fo
     }
 }
 
-template <typename input_type>
-void DataVault<input_type>::getBytesFromValue(input_type value, uint8_t* bytes) const {
-    int16_t curr_value;
-    if constexpr (std::is_floating_point<input_type>::value) {
-        curr_value = static_cast<int>(round(value * 10));
-    } else if constexpr (std::is_integral<input_type>::value) {
-        curr_value = static_cast<int>(value);
+template <typename input_type, uint16_t capacity, typename storage>
+void DataVault<input_type, capacity, storage>::pushPoint(stored_type value) {
+    _data.push(value);
+    updateTrendSums(value);
+
+    if (_hours.accumulate({value, value, value})) {
+        _days.accumulate(_hours.getLast());
     }
-    bytes[0] = (curr_value >> 8) & 0xFF;
-    bytes[1] = curr_value & 0xFF;
 }
 
-template <typename input_type>
-input_type DataVault<input_type>::getValueFromBytes(uint8_t* bytes) const {
-    int16_t curr_value = (bytes[0] << 8) | bytes[1];
-    if constexpr (std::is_floating_point<input_type>::value) {
-        return (float) static_cast<float>(curr_value) / 10;
-    } else if constexpr (std::is_integral<input_type>::value) {
-        return static_cast<input_type>(curr_value);
+template <typename input_type, uint16_t capacity, typename storage>
+void DataVault<input_type, capacity, storage>::updateTrendSums(stored_type value) {
+    typedef typename storage::sum_type sum_type;
+    if (_trend_count < TREND_PNTS_AMT) {
+        _trend_sum_xy += (sum_type) _trend_count * value;
+        _trend_sum_y += value;
+        _trend_count++;
+    } else {
+        stored_type leaving = _data[_data.getCount() - TREND_PNTS_AMT - 1];
+        _trend_sum_y -= leaving;
+        _trend_sum_xy += (sum_type) (TREND_PNTS_AMT - 1) * value - _trend_sum_y;
+        _trend_sum_y += value;
     }
 }
 
-template <typename input_type>
-uint16_t DataVault<input_type>::findStartIndex(uint8_t backstep_time_period) const {
-    uint16_t end_time = findMinutesOfDay(_data[_head_count - 1].hour, _data[_head_count - 1].minute);
+template <typename input_type, uint16_t capacity, typename storage>
+void DataVault<input_type, capacity, storage>::clearPoints() {
+    _data.clear();
+    _hours.clear();
+    _days.clear();
+    _trend_sum_y = _trend_sum_xy = 0;
+    _trend_count = 0;
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+int16_t DataVault<input_type, capacity, storage>::findJournalPoint(uint32_t age) const {
+    typedef ScaledStorage<input_type> backup;
+    // Slots older than the ring keep a placeholder, restore and paging skip it
+    if (age >= _data.getCount()) return JOURNAL_VOID;
+    stored_type value = _data[_data.getCount() - 1 - age];
+    if constexpr (std::is_base_of<backup, storage>::value) return value;
+    else return backup::encode(storage::decode(value));
+}
 
-    for (int16_t i = _head_count - 1; i >= 0; --i) {
-        uint16_t point_time = findMinutesOfDay(_data[i].hour, _data[i].minute);
-        if (findDayMinutesDifference(end_time, point_time) >= backstep_time_period) {
-            return i;
-        }
-    }
-    return 0;
+template <typename input_type, uint16_t capacity, typename storage>
+typename storage::stored_type DataVault<input_type, capacity, storage>::decodeJournalPoint(int16_t point) {
+    typedef ScaledStorage<input_type> backup;
+    if constexpr (std::is_base_of<backup, storage>::value) return point;
+    else return storage::encode(backup::decode(point));
 }
 
-template <typename input_type>
-int8_t DataVault<input_type>::normalizeSlope(float slope) const {
-    return constrain((float) 100 * (slope / _norm_coef), -100, 100);
+template <typename input_type, uint16_t capacity, typename storage>
+int8_t DataVault<input_type, capacity, storage>::normalizeSlope(float slope, float norm_range) {
+    return constrain((float) 100 * (slope / norm_range), -100, 100);
 }
\ No newline at end of file
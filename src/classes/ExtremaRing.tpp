@@ -0,0 +1,68 @@
+template <typename value_type, uint16_t capacity>
+void ExtremaRing<value_type, capacity>::push(value_type value) {
+    _values.push(value);
+
+    if (_push_count % EXTR_BLOCK_LEN == 0) {
+        _blocks.push({value, value});
+    } else {
+        Extremes<value_type>& block = _blocks[_blocks.getCount() - 1];
+        block.max = max(block.max, value);
+        block.min = min(block.min, value);
+    }
+    _push_count++;
+}
+
+template <typename value_type, uint16_t capacity>
+void ExtremaRing<value_type, capacity>::clear() {
+    _values.clear();
+    _blocks.clear();
+    _push_count = 0;
+}
+
+template <typename value_type, uint16_t capacity>
+value_type ExtremaRing<value_type, capacity>::operator[](uint16_t index) const {
+    return _values[index];
+}
+
+template <typename value_type, uint16_t capacity>
+value_type ExtremaRing<value_type, capacity>::getLast() const {
+    return _values.getLast();
+}
+
+template <typename value_type, uint16_t capacity>
+uint16_t ExtremaRing<value_type, capacity>::getContiguous(uint16_t index, const value_type** items) const {
+    return _values.getContiguous(index, items);
+}
+
+template <typename value_type, uint16_t capacity>
+uint16_t ExtremaRing<value_type, capacity>::getCount() const {
+    return _values.getCount();
+}
+
+template <typename value_type, uint16_t capacity>
+bool ExtremaRing<value_type, capacity>::isFull() const {
+    return _values.isFull();
+}
+
+template <typename value_type, uint16_t capacity>
+Extremes<value_type> ExtremaRing<value_type, capacity>::findExtremes(uint16_t startpoint, uint16_t endpoint) const {
+    Extremes<value_type> result = {_values[startpoint], _values[startpoint]};
+    uint32_t first_seq = _push_count - _values.getCount();
+    uint32_t last_block = (_push_count - 1) / EXTR_BLOCK_LEN;
+
+    for (uint16_t i = startpoint; i <= endpoint;) {
+        uint32_t seq = first_seq + i;
+        if (seq % EXTR_BLOCK_LEN == 0 && i + EXTR_BLOCK_LEN - 1 <= endpoint) {
+            const Extremes<value_type>& block = _blocks[_blocks.getCount() - 1
+                                                        - (last_block - seq / EXTR_BLOCK_LEN)];
+            result.max = max(result.max, block.max);
+            result.min = min(result.min, block.min);
+            i += EXTR_BLOCK_LEN;
+        } else {
+            result.max = max(result.max, _values[i]);
+            result.min = min(result.min, _values[i]);
+            i++;
+        }
+    }
+    return result;
+}
@@ -1,60 +1,120 @@
-template <typename input_type>
-Graph<input_type>::Graph(DataVault<input_type>& data_ref, Adafruit_ILI9341& tft_ref)
-    : _data(data_ref), _tft(tft_ref) {
+template <typename input_type, uint16_t capacity, typename storage>
+Graph<input_type, capacity, storage>::Graph(DataVault<input_type, capacity, storage>& data_ref,
+                                            const TimeColumn& time_ref, I2C_eeprom& eeprom_ref,
+                                            SemaphoreHandle_t bus_lock, const HistorySpan& history,
+                                            Adafruit_ILI9341& tft_ref, SPIClass& spi_ref)
+    : _data(data_ref), _time(time_ref), _history(eeprom_ref, bus_lock, history), _tft(tft_ref),
+      _spi(spi_ref) {
 }
 
-template <typename input_type>
-void Graph<input_type>::drawLocal(bool local_sizing) {
+template <typename input_type, uint16_t capacity, typename storage>
+Graph<input_type, capacity, storage>::~Graph() {
+    resetScroll();
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::drawLocal(bool local_sizing) {
     staticGraphCore(_curr_endp, local_sizing);
 }
 
-template <typename input_type>
-void Graph<input_type>::drawFresh(bool local_sizing) {
-    staticGraphCore(_data.getHeadCount() - 1, local_sizing);
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::drawFresh(bool local_sizing) {
+    staticGraphCore(findHeadCount() - 1, local_sizing);
 }
 
-template <typename input_type>
-void Graph<input_type>::drawCursor(bool initial) {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::drawCursor(bool initial) {
     if (initial) _curr_index = findDataEdge() >> 1;
     drawCursorPointer();
     drawCursorData();
 }
 
-template <typename input_type>
-void Graph<input_type>::dynamicPan(int8_t step) {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::dynamicPan(int8_t step) {
+    if (findHeadCount() <= TFT_XMAX - L_EDGE) return;
     int16_t prev_startp = _curr_startp;
+    _pan_dir = (step < 0) ? -1 : 1;
 
     _curr_startp += step;
     _curr_endp += step;
-    _curr_startp = constrain(_curr_startp, 0, _data.getHeadCount() + L_EDGE - TFT_XMAX - 1);
-    _curr_endp = constrain(_curr_endp, TFT_XMAX - L_EDGE, _data.getHeadCount() - 1);
+    _curr_startp = constrain(_curr_startp, 0, findHeadCount() + L_EDGE - TFT_XMAX);
+    _curr_endp = constrain(_curr_endp, TFT_XMAX - L_EDGE - 1, findHeadCount() - 1);
 
     if (prev_startp != _curr_startp) {
-        updateCurve();
+        if constexpr (PAN_SCROLL) scrollCurve(_curr_startp - prev_startp);
+        else updateCurve();
         updateAxises();
         updateTicks();
         updateWeekdays();
     }
 }
 
-template <typename input_type>
-void Graph<input_type>::dynamicCursor(int8_t step) {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::dynamicCursor(int8_t step) {
     _prev_index = _curr_index;
     _curr_index += step;
     _curr_index = constrain(_curr_index, CRECT_HALF, findDataEdge() - CRECT_HALF);
 
     if (_prev_index != _curr_index) {
         erasePrevCursor();
-        if (abs(_prev_values[_prev_index] - BT_EDGE + UP_EDGE) <= CRECT_HALF) {
-            updateAxises(true);
-            updateTicks();
-        } else updateAxises();
         drawCursor();
     }
 }
 
-template <typename input_type>
-void Graph<input_type>::annotate(bool dayscale) {
+template <typename input_type, uint16_t capacity, typename storage>
+bool Graph<input_type, capacity, storage>::shiftTier(int8_t step) {
+    int8_t tier = constrain(_tier + step, RAW_TIER, DAY_TIER);
+    if (tier == _tier || _data.getHeadCount((tiers) tier) < 2) return false;
+
+    _tier = (tiers) tier;
+    _curr_endp = findHeadCount() - 1;
+    return true;
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::resetTier() {
+    shiftTier(RAW_TIER - _tier);
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+bool Graph<input_type, capacity, storage>::setHistory(const HistorySpan& span) {
+    int32_t shift = span.first_seq - _history.getFirstSeq();
+    _history.setSpan(span);
+    if (_tier != RAW_TIER || shift == 0) return false;
+
+    // Raw indexes count from the span start, so the viewport follows its samples when a commit moves it
+    int32_t startp = _curr_startp - shift, endp = _curr_endp - shift;
+    int32_t last = findHeadCount() - 1;
+    bool moved = startp < 0 || endp > last;
+    if (startp < 0) {
+        endp -= startp;
+        startp = 0;
+    }
+    if (endp > last) {
+        startp = max(startp - (endp - last), (int32_t) 0);
+        endp = last;
+    }
+    _curr_startp = startp;
+    _curr_endp = endp;
+    _cached_endp = _cached_startp - 1;
+    return moved;
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::prefetch() {
+    if (_tier != RAW_TIER) return;
+
+    // Loads the journal pages the next pan step would reveal, so panning itself rarely waits on EEPROM
+    int16_t edge = (_pan_dir < 0) ? _curr_startp : _curr_endp;
+    for (uint8_t step = 1; step < PAN_FAST + JOURNAL_PAGE_PNTS; step += JOURNAL_PAGE_PNTS) {
+        int16_t index = edge + _pan_dir * min(step, (uint8_t) PAN_FAST);
+        if (index >= 0) _history.prefetch(index);
+    }
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::annotate(bool dayscale) {
+    _dayscale = dayscale;
     if (dayscale) updateWeekdays(true);
 
     _tft.setTextColor(TEXT_CLR4);
@@ -62,8 +122,8 @@ void Graph<input_type>::annotate(bool dayscale) {
     _tft.setFont(&CustomFont10pt);
 
     char max[10], min[10];
-    _data.getCharValue(_curr_max, max);
-    _data.getCharValue(_curr_min, min);
+    _data.getCharValue(storage::decode(_curr_max), max);
+    _data.getCharValue(storage::decode(_curr_min), min);
     _tft.setCursor(5, UP_EDGE + 40);
     _tft.print(max);
     _tft.setCursor(5, BT_EDGE - 15);
@@ -79,8 +139,8 @@ void Graph<input_type>::annotate(bool dayscale) {
     _tft.drawFastHLine(5, BT_EDGE - 10, 2 + width, LINK_CLR);
 }
 
-template <typename input_type>
-void Graph<input_type>::drawLogos(enum screens screen, bool summertemp) {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::drawLogos(enum screens screen, bool summertemp) {
     if (summertemp) {
         _tft.drawRGBBitmap(graph_icon.x, graph_icon.y,
                            summer_graph_icons[screen], graph_icon.width, graph_icon.height);
@@ -92,85 +152,226 @@ void Graph<input_type>::drawLogos(enum screens screen, bool summertemp) {
                        tal_tech, tech_icon.width, tech_icon.height);
 }
 
-template <typename input_type>
-void Graph<input_type>::staticGraphCore(int16_t endp, bool local_sizing) {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::staticGraphCore(int16_t endp, bool local_sizing) {
     int16_t startp;
 
     _curr_endp = endp;
-    _curr_startp = startp = max(endp + L_EDGE - TFT_XMAX, 0);
+    _curr_startp = startp = max(endp + L_EDGE - TFT_XMAX + 1, 0);
     if (!local_sizing) {
-        endp = _data.getHeadCount() - 1;
+        endp = findHeadCount() - 1;
         startp = 0;
     }
-    _curr_max = _data.findSampleMax(startp, endp);
-    _curr_min = _data.findSampleMin(startp, endp);
+    Extremes<stored_type> extremes = findExtremes(startp, endp);
+    _curr_max = extremes.max;
+    _curr_min = extremes.min;
     findAxisLevel();
 
+    resetScroll();
     _tft.fillScreen(0x0000);
+    _dayscale = false;
     updateCurve(true);
     updateAxises(true);
     updateTicks(true);
 }
 
-template <typename input_type>
-void Graph<input_type>::updateCurve(bool initial) {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::updateCurve(bool initial) {
     int16_t x = L_EDGE;
 
-    if (initial) {
-        if (_curr_min >= 0) {
-            memset(_prev_values, BT_EDGE - UP_EDGE - 1, sizeof(_prev_values));
-        } else if (_curr_max <= 0) {
-            memset(_prev_values, 1, sizeof(_prev_values));
-        } else memset(_prev_values, _curr_level - UP_EDGE, sizeof(_prev_values));
+    // The cleared plot starts flat on the axis, so every column is drawn, even the one on the range edge
+    if (initial) memset(_prev_values, _curr_level - UP_EDGE, sizeof(_prev_values));
+
+    // Appended points shift the indexes, so the cached rows only survive pans between appends
+    if (initial || _cached_epoch != _time.getEpoch()) {
+        _cached_endp = _cached_startp - 1;
+        _cached_epoch = _time.getEpoch();
     }
 
     for (int16_t i = _curr_startp; i <= _curr_endp; i++) {
-        uint8_t h = round(mapFloat(_data.getData()[i].value,
-                                   _curr_min, _curr_max, BT_EDGE - UP_EDGE - 1, 1));
-        int16_t diff = h - _prev_values[x - L_EDGE];
+        uint8_t h = findCurveRow(i);
+        uint8_t prev_h = _prev_values[x - L_EDGE];
         _prev_values[x - L_EDGE] = h;
 
-        if (diff == 0) {
-            x++;
-            continue;
-        }
-        if (diff > 0) diff++;
-        else diff--;
-
-        uint16_t primary_color, secondary_color;
-        bool junction = false;
-
-        if (_curr_min >= 0) primary_color = (diff > 0) ? 0x0000 : PLOT_CLR;
-        else if (_curr_max <= 0) primary_color = (diff > 0) ? PLOT_CLR : 0x0000;
-        else {
-            if (diff > 0) {
-                if (h + UP_EDGE > _curr_level && h - diff + UP_EDGE >= _curr_level) {
-                    primary_color = PLOT_CLR;
-                } else if (h + UP_EDGE > _curr_level && h - diff + UP_EDGE < _curr_level) {
-                    junction = true;
-                    primary_color = PLOT_CLR; secondary_color = 0x0000;
-                } else primary_color = 0x0000;
-            } else {
-                if (h + UP_EDGE >= _curr_level && h - diff + UP_EDGE > _curr_level) {
-                    primary_color = 0x0000;
-                } else if (h + UP_EDGE < _curr_level && h - diff + UP_EDGE > _curr_level) {
-                    junction = true;
-                    primary_color = PLOT_CLR; secondary_color = 0x0000;
-                } else primary_color = PLOT_CLR;
-            }
+        if (h != prev_h) drawCurveColumn(x, h, h - prev_h);
+        x++;
+    }
+    _cached_startp = _curr_startp;
+    _cached_endp = _curr_endp;
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+uint8_t Graph<input_type, capacity, storage>::findCurveRow(int16_t index) {
+    // The viewport never spans more than the cache, so a newly exposed index only reuses a slot left behind
+    uint8_t& row = _row_cache[index % (TFT_XMAX - L_EDGE)];
+    if (index < _cached_startp || index > _cached_endp) row = findPixelRow(findStoredValue(index));
+    return row;
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+uint8_t Graph<input_type, capacity, storage>::findPixelRow(stored_type value) const {
+    if constexpr (std::is_integral<stored_type>::value) {
+        int32_t offset = constrain(value, _curr_min, _curr_max) - _curr_min;
+        return BT_EDGE - UP_EDGE - 1 - ((offset * _row_scale + 0x8000) >> 16);
+    } else return round(mapFloat(value, _curr_min, _curr_max, BT_EDGE - UP_EDGE - 1, 1));
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::drawCurveColumn(int16_t x, uint8_t h, int16_t diff) {
+    if (diff > 0) diff++;
+    else diff--;
+
+    uint16_t primary_color, secondary_color;
+    bool junction = false;
+
+    if (_curr_min >= 0) primary_color = (diff > 0) ? 0x0000 : PLOT_CLR;
+    else if (_curr_max <= 0) primary_color = (diff > 0) ? PLOT_CLR : 0x0000;
+    else {
+        if (diff > 0) {
+            if (h + UP_EDGE > _curr_level && h - diff + UP_EDGE >= _curr_level) {
+                primary_color = PLOT_CLR;
+            } else if (h + UP_EDGE > _curr_level && h - diff + UP_EDGE < _curr_level) {
+                junction = true;
+                primary_color = PLOT_CLR; secondary_color = 0x0000;
+            } else primary_color = 0x0000;
+        } else {
+            if (h + UP_EDGE >= _curr_level && h - diff + UP_EDGE > _curr_level) {
+                primary_color = 0x0000;
+            } else if (h + UP_EDGE < _curr_level && h - diff + UP_EDGE > _curr_level) {
+                junction = true;
+                primary_color = PLOT_CLR; secondary_color = 0x0000;
+            } else primary_color = PLOT_CLR;
         }
+    }
 
-        if (junction) {
-            _tft.drawFastVLine(x, UP_EDGE + h, _curr_level - h - UP_EDGE, primary_color);
-            _tft.drawFastVLine(x, _curr_level, UP_EDGE + h - diff - _curr_level, secondary_color);
-        } else _tft.drawFastVLine(x, UP_EDGE + h, -diff, primary_color);
+    if (junction) {
+        _tft.drawFastVLine(x, UP_EDGE + h, _curr_level - h - UP_EDGE, primary_color);
+        _tft.drawFastVLine(x, _curr_level, UP_EDGE + h - diff - _curr_level, secondary_color);
+    } else _tft.drawFastVLine(x, UP_EDGE + h, -diff, primary_color);
+}
 
-        x++;
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::scrollCurve(int16_t shift) {
+    constexpr int16_t width = TFT_XMAX - L_EDGE;
+    constexpr int16_t link_len = CRECT_HALF - 4;
+    static_assert(PAN_FAST < width, "A pan step must leave part of the plot in place");
+
+    // Everything kept in screen columns moves along with the pixels
+    if (shift > 0) memmove(_prev_values, _prev_values + shift, width - shift);
+    else memmove(_prev_values - shift, _prev_values, width + shift);
+    for (uint8_t i = 0; i * TICK_PER < 24; i++) {
+        if (_tick_posns[i] != -1) _tick_posns[i] -= shift;
+    }
+    _separtr_index -= shift;
+    _spot_posns[0] -= shift;
+    _spot_posns[1] -= shift;
+
+    // The annotation link stays in place while the plot row under it moves
+    fillScrolledRect(L_EDGE, UP_EDGE, link_len, 1, (_curr_level == UP_EDGE) ? AXIS_CLR : 0x0000);
+    _scrolled = true;
+    _scroll_start = (_scroll_start + width - shift) % width;
+    _tft.scrollTo(_scroll_start);
+
+    // Only the exposed columns are drawn, unless an appended point shifted the indexes of the rest
+    int16_t first = 0, last = width - 1;
+    if (_cached_epoch == _time.getEpoch()) {
+        if (shift > 0) first = width - shift;
+        else last = -shift - 1;
+    } else {
+        _cached_endp = _cached_startp - 1;
+        _cached_epoch = _time.getEpoch();
+    }
+
+    _tft.startWrite();
+    for (int16_t i = first; i <= last; i++) {
+        _prev_values[i] = findCurveRow(_curr_startp + i);
+        drawScrolledColumn(L_EDGE + i);
+    }
+    _tft.endWrite();
+    _cached_startp = _curr_startp;
+    _cached_endp = _curr_endp;
+    fillScrolledRect(L_EDGE, UP_EDGE, link_len, 1, LINK_CLR);
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::resetScroll() {
+    if (!_scrolled) return;
+    _scrolled = false;
+    _scroll_start = 0;
+    _tft.scrollTo(0);
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::drawScrolledColumn(int16_t x) {
+    uint16_t pixels[TFT_YMAX];
+
+    // The whole column is rebuilt from the plot model, weekday and tick labels are drawn over it afterwards
+    for (int16_t y = 0; y < TFT_YMAX; y++) pixels[y] = findWireColor(x, y);
+    writeBlock(findScrolledX(x), 0, 1, TFT_YMAX, pixels);
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+int16_t Graph<input_type, capacity, storage>::findScrolledX(int16_t x) const {
+    // In rotation 3 the panel lines run from the right edge, the scroll area wraps between L_EDGE and TFT_XMAX,
+    // unscrolled plot columns map onto themselves
+    return TFT_XMAX - 1 - (_scroll_start + TFT_XMAX - 1 - x) % (TFT_XMAX - L_EDGE);
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::fillScrolledRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                                            uint16_t color) {
+    if (!PAN_SCROLL) {
+        _tft.fillRect(x, y, w, h, color);
+        return;
+    }
+
+    // Nothing goes into the fixed area, it would stay behind once the plot columns scroll
+    int16_t left = max(x, int16_t(L_EDGE));
+    int16_t right = min(int16_t(x + w), int16_t(TFT_XMAX));
+    while (left < right) {
+        int16_t draw_x = findScrolledX(left);
+        int16_t run = min(int16_t(right - left), int16_t(TFT_XMAX - draw_x));
+        _tft.fillRect(draw_x, y, run, h, color);
+        left += run;
     }
 }
 
-template <typename input_type>
-void Graph<input_type>::updateAxises(bool initial) {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::printScrolled(int16_t x, int16_t y, const char* text, uint8_t len,
+                                                         const GFXfont* font, uint16_t color) {
+    char buffer[12];
+    len = min(len, uint8_t(sizeof(buffer) - 1));
+    memcpy(buffer, text, len);
+    buffer[len] = '\0';
+
+    int16_t x1, y1;
+    uint16_t w, h;
+    _tft.getTextBounds(buffer, x, y, &x1, &y1, &w, &h);
+    if (!PAN_SCROLL || (x1 >= L_EDGE && x1 + w <= TFT_XMAX && findScrolledX(x1) + w <= TFT_XMAX)) {
+        _tft.setCursor(PAN_SCROLL ? x + findScrolledX(x1) - x1 : x, y);
+        _tft.print(buffer);
+        return;
+    }
+
+    // Text across the memory seam or the fixed area edge is rendered off-screen and copied column by column,
+    // the part over the fixed area is dropped even before the first scroll
+    GFXcanvas1 canvas(w, h);
+    canvas.setFont(font);
+    canvas.setCursor(x - x1, y - y1);
+    canvas.print(buffer);
+
+    _tft.startWrite();
+    for (int16_t i = max(0, L_EDGE - x1); i < w && x1 + i < TFT_XMAX; i++) {
+        int16_t draw_x = findScrolledX(x1 + i);
+        for (uint16_t j = 0; j < h; j++) {
+            if (canvas.getPixel(i, j)) _tft.writePixel(draw_x, y1 + j, color);
+        }
+    }
+    _tft.endWrite();
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::updateAxises(bool initial) {
     _tft.drawFastHLine(L_EDGE - CRECT_HALF, _curr_level, TFT_XMAX - L_EDGE + CRECT_HALF, AXIS_CLR);
 
     if (initial) {
@@ -181,8 +382,61 @@ void Graph<input_type>::updateAxises(bool initial) {
     }
 }
 
-template <typename input_type>
-void Graph<input_type>::updateTicks(bool initial) {
+template <typename input_type, uint16_t capacity, typename storage>
+Timestamp Graph<input_type, capacity, storage>::findTimestamp(uint16_t index) const {
+    return _time.getTimestamp(findBackstep(index));
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+uint32_t Graph<input_type, capacity, storage>::findEpochMinute(uint16_t index) const {
+    return _time.getEpoch() / 60 - findBackstep(index);
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+uint16_t Graph<input_type, capacity, storage>::findHeadCount() const {
+    return _data.getHeadCount(_tier) + findDeepCount();
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+uint16_t Graph<input_type, capacity, storage>::findDeepCount() const {
+    return (_tier == RAW_TIER) ? _history.getCount() : 0;
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+typename storage::stored_type Graph<input_type, capacity, storage>::findStoredValue(uint16_t index) {
+    uint16_t deep_count = findDeepCount();
+    if (index >= deep_count) return _data.getStoredValue(index - deep_count, _tier);
+    return _data.decodeJournalPoint(_history.getPoint(index));
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+Extremes<typename storage::stored_type>
+Graph<input_type, capacity, storage>::findExtremes(uint16_t startpoint, uint16_t endpoint) {
+    uint16_t deep_count = findDeepCount();
+    if (startpoint >= deep_count) {
+        return _data.findSampleExtremes(startpoint - deep_count, endpoint - deep_count, _tier);
+    }
+
+    Extremes<int16_t> deep = _history.findExtremes(startpoint, min(endpoint, (uint16_t) (deep_count - 1)));
+    if (deep.max < deep.min) deep.max = deep.min = _history.getPoint(startpoint);
+    Extremes<stored_type> extremes = {_data.decodeJournalPoint(deep.max), _data.decodeJournalPoint(deep.min)};
+    if (endpoint >= deep_count) {
+        Extremes<stored_type> ring = _data.findSampleExtremes(0, endpoint - deep_count, _tier);
+        extremes.max = max(extremes.max, ring.max);
+        extremes.min = min(extremes.min, ring.min);
+    }
+    return extremes;
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+uint32_t Graph<input_type, capacity, storage>::findBackstep(uint16_t index) const {
+    uint16_t deep_count = findDeepCount();
+    if (index >= deep_count) return _data.findBackstep(index - deep_count, _tier);
+    return _data.findBackstep(0, _tier) + (uint32_t) (deep_count - index) * APD_PER_S;
+}
+
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::updateTicks(bool initial) {
     _tft.setTextColor(TEXT_CLR1);
     _tft.setTextSize(1);
     _tft.setFont();
@@ -191,39 +445,44 @@ void Graph<input_type>::updateTicks(bool initial) {
     else {
         for (uint8_t i = 0; i * TICK_PER < 24; i++) {
             if (_tick_posns[i] != -1 && _tick_posns[i] < TFT_XMAX - 15) {
-                _tft.drawFastVLine(_tick_posns[i], BT_EDGE + 1, TICK_LEN, 0x0000);
-                _tft.fillRect(_tick_posns[i] - 14, BT_EDGE + 7, 31, 15, 0x0000);
+                fillScrolledRect(_tick_posns[i], BT_EDGE + 1, 1, TICK_LEN, 0x0000);
+                fillScrolledRect(_tick_posns[i] - 14, BT_EDGE + 7, 31, 15, 0x0000);
                 _tick_posns[i] = -1;
             }
         }
     }
+    if (_tier != RAW_TIER) return;
 
+    // Samples lie APD_PER_S minutes apart, so each tick is a known number of samples past the window start
+    uint16_t first = max(_curr_startp, int16_t(1));
+    uint32_t first_min = findEpochMinute(first);
+    uint16_t day_min = first_min % (24 * 60);
     for (uint8_t i = 0; i * TICK_PER < 24; i++) {
         uint8_t tick = i * TICK_PER;
-        for (uint16_t j = _curr_startp; j <= _curr_endp; j++) {
-            if (j == 0) continue;
-            if (_data.getData()[j].hour == tick) {
-                int8_t diff = min((int8_t)_data.getData()[j].minute,
-                                  int8_t(60 - _data.getData()[j - 1].minute));
-                _tick_posns[i] = j - _curr_startp + L_EDGE;
-                if (diff != _data.getData()[j].minute) _tick_posns[i]--;
-                break;
-            }
+        uint16_t tick_min = tick * 60;
+        uint32_t j = first;
+        if (day_min < tick_min || day_min >= tick_min + 60) {
+            j += ((tick_min + 24 * 60 - day_min) % (24 * 60) + APD_PER_S - 1) / APD_PER_S;
+        }
+        if (j <= _curr_endp) {
+            uint32_t stamp_min = first_min + (j - first) * APD_PER_S;
+            uint8_t minute = stamp_min % 60;
+            _tick_posns[i] = j - _curr_startp + L_EDGE;
+            if (60 - (stamp_min - APD_PER_S) % 60 < minute) _tick_posns[i]--;
         }
         if (_tick_posns[i] != -1 && _tick_posns[i] < TFT_XMAX - 15) {
-            char hours[2];
-            _tft.drawFastVLine(_tick_posns[i], BT_EDGE, TICK_LEN, TICK_CLR);
+            char hours[3];
+            fillScrolledRect(_tick_posns[i], BT_EDGE, 1, TICK_LEN, TICK_CLR);
             itoa(tick, hours, DEC);
-            _tft.setCursor(_tick_posns[i] - 6 * strlen(hours) - 2, BT_EDGE + 7);
-            _tft.print(hours);
-            _tft.setCursor(_tick_posns[i] + 4, BT_EDGE + 7);
-            _tft.print("00");
+            printScrolled(_tick_posns[i] - 6 * strlen(hours) - 2, BT_EDGE + 7, hours, strlen(hours),
+                          nullptr, TEXT_CLR1);
+            printScrolled(_tick_posns[i] + 4, BT_EDGE + 7, "00", 2, nullptr, TEXT_CLR1);
         }
     }
 }
 
-template <typename input_type>
-void Graph<input_type>::updateWeekdays(bool initial) {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::updateWeekdays(bool initial) {
     _tft.setTextColor(TEXT_CLR2);
     _tft.setTextSize(1);
     _tft.setFont(&CustomFont10pt);
@@ -232,56 +491,71 @@ void Graph<input_type>::updateWeekdays(bool initial) {
         _tft.fillRect(L_EDGE - 1, UP_EDGE - 14, TFT_XMAX - L_EDGE, 2, SEP_CLR);
         _tft.drawFastVLine(L_EDGE - 1, 0, UP_EDGE - TICK_LEN, AXIS_CLR);
     } else {
-        _tft.fillRect(_separtr_index, UP_EDGE - 15, 2, -SEP_LEN, 0x0000);
-        _tft.fillRect(_spot_posns[0], UP_EDGE - 40, 19 * _spot_lengths[0], 20, 0x0000);
-        _tft.fillRect(_spot_posns[1], UP_EDGE - 40, 19 * _spot_lengths[1], 20, 0x0000);
+        fillScrolledRect(_separtr_index, UP_EDGE - 15, 2, -SEP_LEN, 0x0000);
+        fillScrolledRect(_spot_posns[0], UP_EDGE - 40, 19 * _spot_lengths[0], 20, 0x0000);
+        fillScrolledRect(_spot_posns[1], UP_EDGE - 40, 19 * _spot_lengths[1], 20, 0x0000);
     }
-
-    _separtr_index = L_EDGE;
-    for (uint16_t i = _curr_startp; i <= _curr_endp; i++) {
-        if (i == 0) continue;
-        if (_data.getData()[i].weekday != _data.getData()[i - 1].weekday) {
-            _separtr_index = i - _curr_startp + L_EDGE;
-            break;
-        }
+    if (_tier != RAW_TIER) {
+        _separtr_index = L_EDGE;
+        _spot_lengths[0] = _spot_lengths[1] = 0;
+        return;
     }
 
-    _tft.fillRect(_separtr_index, UP_EDGE - 15, 2, -SEP_LEN, SEP_CLR);
+    // The separator goes on the first sample past midnight
+    _separtr_index = L_EDGE;
+    uint16_t first = max(_curr_startp, int16_t(1));
+    uint32_t prev_min = findEpochMinute(first - 1);
+    uint32_t midnight = (prev_min / (24 * 60) + 1) * 24 * 60;
+    uint32_t i = first - 1 + (midnight - prev_min + APD_PER_S - 1) / APD_PER_S;
+    if (i <= _curr_endp) _separtr_index = i - _curr_startp + L_EDGE;
+
+    fillScrolledRect(_separtr_index, UP_EDGE - 15, 2, -SEP_LEN, SEP_CLR);
+    uint8_t end_wday = findTimestamp(_curr_endp).weekday;
+    uint8_t start_wday = findTimestamp(_curr_startp).weekday;
     if (_separtr_index < TFT_XMAX - 60) {
         _spot_lengths[0] = constrain((TFT_XMAX - _separtr_index) / 25, 3,
-                                      strlen(weekdays[_data.getData()[_curr_endp].weekday]));
+                                      strlen(weekdays[end_wday]));
         _spot_posns[0] = ((_separtr_index + TFT_XMAX) >> 1) - ((16 * _spot_lengths[0]) >> 1);
         _spot_posns[0] = constrain(_spot_posns[0], L_EDGE, TFT_XMAX);
-        _tft.setCursor(_spot_posns[0], UP_EDGE - 25);
-        _tft.write(weekdays[_data.getData()[_curr_endp].weekday], _spot_lengths[0]);
+        printScrolled(_spot_posns[0], UP_EDGE - 25, weekdays[end_wday], _spot_lengths[0],
+                      &CustomFont10pt, TEXT_CLR2);
     }
     if (_separtr_index > L_EDGE + 60) {
         _spot_lengths[1] = constrain((_separtr_index - L_EDGE) / 25, 3,
-                                      strlen(weekdays[_data.getData()[_curr_startp].weekday]));
+                                      strlen(weekdays[start_wday]));
         _spot_posns[1] = ((_separtr_index + L_EDGE) >> 1) - ((16 * _spot_lengths[1]) >> 1);
         _spot_posns[1] = constrain(_spot_posns[1], L_EDGE, TFT_XMAX);
-        _tft.setCursor(_spot_posns[1], UP_EDGE - 25);
-        _tft.write(weekdays[_data.getData()[_curr_startp].weekday], _spot_lengths[1]);
+        printScrolled(_spot_posns[1], UP_EDGE - 25, weekdays[start_wday], _spot_lengths[1],
+                      &CustomFont10pt, TEXT_CLR2);
     }
 }
 
-template <typename input_type>
-void Graph<input_type>::drawCursorPointer() {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::drawCursorPointer() {
     _cursor_x = _curr_index + L_EDGE;
     uint16_t rect_x = _cursor_x - CRECT_HALF;
     uint16_t rect_y = _prev_values[_curr_index] + UP_EDGE - CRECT_HALF;
 
+    // The display can't be read back, so the pixels under the cursor are rendered from the plot model
+    uint16_t* pixel = _rect_under;
+    for (int16_t y = rect_y; y < rect_y + CRECT_SIDE; y++) {
+        for (int16_t x = rect_x; x < rect_x + CRECT_SIDE; x++) *pixel++ = findWireColor(x, y);
+    }
+    for (int16_t y = UP_EDGE - CRECT_SIDE; y < BT_EDGE; y++) {
+        _line_under[y - UP_EDGE + CRECT_SIDE] = findWireColor(_cursor_x, y);
+    }
+
     _tft.drawRect(rect_x, rect_y, CRECT_SIDE, CRECT_SIDE, CRSR_CLR);
     _tft.drawRect(rect_x + 1, rect_y + 1, CRECT_SIDE - 2, CRECT_SIDE - 2, CRSR_CLR);
     _tft.drawFastVLine(_cursor_x, UP_EDGE - CRECT_SIDE, BT_EDGE - UP_EDGE + CRECT_SIDE, CRSR_CLR);
 }
 
-template <typename input_type>
-void Graph<input_type>::drawCursorData() {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::drawCursorData() {
     char time[6], value[10];
 
-    _data.getCharTime(_curr_startp + _curr_index, time);
-    _data.getCharValue(_data.getData()[_curr_startp + _curr_index].value, value);
+    _time.getCharTime(findBackstep(_curr_startp + _curr_index), time);
+    _data.getCharValue(storage::decode(findStoredValue(_curr_startp + _curr_index)), value);
     uint8_t time_len = strlen(time);
     uint8_t value_len = strlen(value);
     _window_width = 6 * max(time_len, value_len) + 8;
@@ -306,127 +580,86 @@ void Graph<input_type>::drawCursorData() {
     _tft.print(value);
 }
 
-template <typename input_type>
-void Graph<input_type>::erasePrevCursor() {
-    eraseCursorRect();
-    eraseCursorLine();
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::erasePrevCursor() {
+    eraseCursorPointer();
     eraseCursorData();
 }
 
-template <typename input_type>
-void Graph<input_type>::eraseCursorRect() {
-    int16_t x = L_EDGE + _prev_index - CRECT_HALF;
-    int16_t prev_val_lower = _prev_values[_prev_index] - CRECT_HALF;
-    int16_t prev_val_upper = _prev_values[_prev_index] + CRECT_HALF;
-    int16_t curr_relative_level = _curr_level - UP_EDGE;
-
-    for (uint16_t i = x - L_EDGE; i <= _prev_index + CRECT_HALF; i++) {
-        int16_t prev_val = _prev_values[i];
-        int16_t vline_start, vline_height;
-        uint16_t color = 0x0000;
-
-        if (prev_val_upper < curr_relative_level) {
-            if (prev_val_lower > prev_val) {
-                vline_start = prev_val_lower + UP_EDGE - 1;
-                vline_height = CRECT_SIDE + 1;
-                color = PLOT_CLR;
-            } else if (prev_val_upper < prev_val) {
-                vline_start = prev_val_lower + UP_EDGE - 1;
-                vline_height = CRECT_SIDE + 1;
-            } else {
-                _tft.drawFastVLine(x, prev_val + UP_EDGE, prev_val_upper - prev_val + 1, PLOT_CLR);
-                _tft.drawFastVLine(x, prev_val + UP_EDGE, prev_val_lower - prev_val - 1, color);
-                x++;
-                continue;
-            }
-        } else if (prev_val_lower > curr_relative_level) {
-            if (prev_val_lower > prev_val) {
-                vline_start = prev_val_lower + UP_EDGE - 1;
-                vline_height = CRECT_SIDE + 1;
-            } else if (prev_val_upper < prev_val) {
-                vline_start = prev_val_lower + UP_EDGE - 1;
-                vline_height = CRECT_SIDE + 1;
-                color = PLOT_CLR;
-            } else {
-                _tft.drawFastVLine(x, prev_val + UP_EDGE, prev_val_upper - prev_val + 1, color);
-                _tft.drawFastVLine(x, prev_val + UP_EDGE, prev_val_lower - prev_val - 1, PLOT_CLR);
-                x++;
-                continue;
-            }
-        } else {
-            int16_t temp = prev_val_lower + UP_EDGE;
-            if (prev_val_lower > prev_val) {
-                _tft.drawFastVLine(x, temp - 1, _curr_level - temp + 1, PLOT_CLR);
-                _tft.drawFastVLine(x, _curr_level, temp + 1 + CRECT_SIDE - _curr_level, color);
-            } else if (prev_val_upper < prev_val) {
-                _tft.drawFastVLine(x, temp - 1, _curr_level - temp + 1, color);
-                _tft.drawFastVLine(x, _curr_level, temp + 1 + CRECT_SIDE - _curr_level, PLOT_CLR);
-            } else if (prev_val <= curr_relative_level) {
-                _tft.drawFastVLine(x, prev_val + UP_EDGE, curr_relative_level - prev_val, PLOT_CLR);
-                _tft.drawFastVLine(x, prev_val + UP_EDGE, prev_val_lower - prev_val - 1, color);
-                _tft.drawFastVLine(x, _curr_level, prev_val_upper - _curr_level + UP_EDGE + 1, color);
-            } else {
-                _tft.drawFastVLine(x, prev_val + UP_EDGE, curr_relative_level - prev_val, PLOT_CLR);
-                _tft.drawFastVLine(x, prev_val + UP_EDGE, prev_val_upper - prev_val + 1, color);
-                _tft.drawFastVLine(x, _curr_level, prev_val_lower - _curr_level + UP_EDGE - 1, color);
-            }
-            x++;
-            continue;
-        }
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::eraseCursorPointer() {
+    uint16_t x = L_EDGE + _prev_index;
+    uint16_t rect_y = _prev_values[_prev_index] + UP_EDGE - CRECT_HALF;
 
-        _tft.drawFastVLine(x, vline_start, vline_height, color);
-        x++;
-    }
+    _tft.startWrite();
+    writeBlock(x, UP_EDGE - CRECT_SIDE, 1, BT_EDGE - UP_EDGE + CRECT_SIDE, _line_under);
+    writeBlock(x - CRECT_HALF, rect_y, CRECT_SIDE, CRECT_SIDE, _rect_under);
+    _tft.endWrite();
 }
 
-template <typename input_type>
-void Graph<input_type>::eraseCursorLine() {
-    int16_t x = L_EDGE + _prev_index;
-    int16_t y = _prev_values[_prev_index] + UP_EDGE;
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::eraseCursorData() {
+    _tft.fillRoundRect(_cursor_x - (_window_width >> 1), 5, _window_width, 30, 3, 0x0000);
+}
 
-    if (_curr_min >= 0) {
-        _tft.drawFastVLine(x, y, BT_EDGE - y, PLOT_CLR);
-        _tft.drawFastVLine(x, y, UP_EDGE - CRECT_SIDE - y - 1, 0x0000);
-    } else if (_curr_max <= 0) {
-        _tft.drawFastVLine(x, y, BT_EDGE - y, 0x0000);
-        _tft.drawFastVLine(x, _curr_level, -CRECT_SIDE - 1, 0x0000);
-        _tft.drawFastVLine(x, y, UP_EDGE - y - 1, PLOT_CLR);
-    } else {
-        _tft.drawFastVLine(x, y, _curr_level - y, PLOT_CLR);
-        if (y < _curr_level) {
-            _tft.drawFastVLine(x, y, UP_EDGE - CRECT_SIDE - y - 1, 0x0000);
-            _tft.drawFastVLine(x, _curr_level, BT_EDGE - _curr_level, 0x0000);
-        } else {
-            _tft.drawFastVLine(x, y, BT_EDGE - y, 0x0000);
-            _tft.drawFastVLine(x, _curr_level, UP_EDGE - CRECT_SIDE - _curr_level - 1, 0x0000);
+template <typename input_type, uint16_t capacity, typename storage>
+uint16_t Graph<input_type, capacity, storage>::findWireColor(int16_t x, int16_t y) const {
+    int16_t curve_y = _prev_values[x - L_EDGE] + UP_EDGE;
+    uint16_t color = 0x0000;
+
+    // The weekday band and separator exist only when annotate drew the day scale
+    if (y == _curr_level || y == BT_EDGE) color = AXIS_CLR;
+    else if (_dayscale && (y == UP_EDGE - 14 || y == UP_EDGE - 13) && x < TFT_XMAX - 1) color = SEP_CLR;
+    else if (y == UP_EDGE && x < L_EDGE + CRECT_HALF - 4) color = LINK_CLR;
+    else if ((y >= curve_y && y < _curr_level) || (y <= curve_y && y > _curr_level)) color = PLOT_CLR;
+    else if (_dayscale && _tier == RAW_TIER && y > UP_EDGE - 15 - SEP_LEN && y <= UP_EDGE - 15
+             && (x == _separtr_index || x == _separtr_index + 1)) color = SEP_CLR;
+    else if (y > BT_EDGE && y < BT_EDGE + TICK_LEN) {
+        for (uint8_t i = 0; i * TICK_PER < 24; i++) {
+            if (x == _tick_posns[i] && x < TFT_XMAX - 15) color = TICK_CLR;
         }
     }
+
+    // Pixels go out as raw bytes, so the color is swapped for the big-endian controller
+    return (color >> 8) | ((color & 0xFF) << 8);
 }
 
-template <typename input_type>
-void Graph<input_type>::eraseCursorData() {
-    _tft.fillRoundRect(_cursor_x - (_window_width >> 1), 5, _window_width, 30, 3, 0x0000);
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::writeBlock(int16_t x, int16_t y, uint16_t w, uint16_t h,
+                                                      uint16_t* pixels) {
+    // Without DMA on this core the block goes out as one blocking transfer, which also overwrites it
+    _tft.setAddrWindow(x, y, w, h);
+    _spi.transfer(pixels, w * h * sizeof(uint16_t));
 }
 
-template <typename input_type>
-void Graph<input_type>::findAxisLevel() {
+template <typename input_type, uint16_t capacity, typename storage>
+void Graph<input_type, capacity, storage>::findAxisLevel() {
+    if constexpr (std::is_integral<stored_type>::value) {
+        // Q16 rows per stored unit, a flat range stays on the bottom row
+        int32_t range = _curr_max - _curr_min;
+        _row_scale = (range > 0) ? ((int32_t) (BT_EDGE - UP_EDGE - 2) << 16) / range : 0;
+    }
+
     if (_curr_min >= 0) _curr_level = BT_EDGE;
     else if (_curr_max <= 0) _curr_level = UP_EDGE;
-    else _curr_level = round(mapFloat(0, _curr_min, _curr_max, BT_EDGE, UP_EDGE));
+    else if constexpr (std::is_integral<stored_type>::value) {
+        int32_t range = _curr_max - _curr_min;
+        _curr_level = BT_EDGE - ((int32_t) -_curr_min * (BT_EDGE - UP_EDGE) + (range >> 1)) / range;
+    } else _curr_level = round(mapFloat(0, _curr_min, _curr_max, BT_EDGE, UP_EDGE));
 }
 
-template <typename input_type>
-float Graph<input_type>::mapFloat(float x, float in_min, float in_max, float out_min, float out_max) {
+template <typename input_type, uint16_t capacity, typename storage>
+float Graph<input_type, capacity, storage>::mapFloat(float x, float in_min, float in_max, float out_min, float out_max) {
     return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
 }
 
-template <typename input_type>
-uint16_t Graph<input_type>::findDataEdge() {
-    return min(int(_data.getHeadCount()), TFT_XMAX - L_EDGE);
+template <typename input_type, uint16_t capacity, typename storage>
+uint16_t Graph<input_type, capacity, storage>::findDataEdge() {
+    return min(int(findHeadCount()), TFT_XMAX - L_EDGE);
 }
 
-template <typename input_type>
-uint16_t Graph<input_type>::getTextWidth(const char* string, Adafruit_ILI9341& tft_reference) {
+template <typename input_type, uint16_t capacity, typename storage>
+uint16_t Graph<input_type, capacity, storage>::getTextWidth(const char* string, Adafruit_ILI9341& tft_reference) {
     int16_t x1, y1;
     uint16_t h, width;
     tft_reference.getTextBounds(string, 0, 0, &x1, &y1, &width, &h);
@@ -0,0 +1,102 @@
+#include <classes/HistoryPager.h>
+
+HistoryPager::HistoryPager(I2C_eeprom& eeprom_ref, SemaphoreHandle_t bus_lock, const HistorySpan& span)
+    : _eeprom(eeprom_ref), _bus_lock(bus_lock), _span(span) {
+    memset(_cached_pages, 0xFF, sizeof(_cached_pages));
+}
+
+int16_t HistoryPager::getPoint(uint16_t index) {
+    uint32_t seq = _span.first_seq + index;
+    const JournalPage* page = loadPage(seq / JOURNAL_PAGE_PNTS);
+
+    // A page failing its checksum or a placeholder repeats the last good point instead of drawing garbage
+    int16_t point = page ? page->points[seq % JOURNAL_PAGE_PNTS] : JOURNAL_VOID;
+    if (point != JOURNAL_VOID) _last_point = point;
+    return _last_point;
+}
+
+Extremes<int16_t> HistoryPager::findExtremes(uint16_t startpoint, uint16_t endpoint) {
+    Extremes<int16_t> extremes = {INT16_MIN, INT16_MAX};
+    uint32_t seq = _span.first_seq + startpoint;
+    uint32_t last_seq = _span.first_seq + endpoint;
+
+    // Whole pages are answered from the RAM index, only the partial pages at both ends are read
+    while (seq <= last_seq) {
+        uint32_t seq_page = seq / JOURNAL_PAGE_PNTS;
+        uint32_t page_end = min(seq_page * JOURNAL_PAGE_PNTS + JOURNAL_PAGE_PNTS - 1, last_seq);
+        Extremes<int16_t> page = _span.page_extremes[seq_page % _span.journal_pages];
+        if (seq % JOURNAL_PAGE_PNTS || page_end % JOURNAL_PAGE_PNTS != JOURNAL_PAGE_PNTS - 1
+            || page.min == JOURNAL_VOID) {
+            page = {INT16_MIN, INT16_MAX};
+            const JournalPage* loaded = loadPage(seq_page);
+            for (uint32_t i = seq; loaded && i <= page_end; i++) {
+                int16_t point = loaded->points[i % JOURNAL_PAGE_PNTS];
+                if (point == JOURNAL_VOID) continue;
+                page.max = max(page.max, point);
+                page.min = min(page.min, point);
+            }
+        }
+        extremes.max = max(extremes.max, page.max);
+        extremes.min = min(extremes.min, page.min);
+        seq = page_end + 1;
+    }
+    return extremes;
+}
+
+void HistoryPager::prefetch(uint16_t index) {
+    if (index < _span.count) loadPage((_span.first_seq + index) / JOURNAL_PAGE_PNTS);
+}
+
+void HistoryPager::setSpan(const HistorySpan& span) {
+    // Cached pages are keyed by sequence, so they stay valid as the span slides forward
+    _span = span;
+}
+
+uint32_t HistoryPager::getFirstSeq() const {
+    return _span.first_seq;
+}
+
+uint16_t HistoryPager::getCount() const {
+    return _span.count;
+}
+
+Extremes<int16_t> HistoryPager::findPageExtremes(const JournalPage& page) {
+    // A torn page or one holding only placeholders adds nothing to the autoscale range
+    Extremes<int16_t> extremes = {INT16_MIN, INT16_MAX};
+    if (findCRC16(page.points, sizeof(page.points)) != page.crc) return extremes;
+    for (uint8_t i = 0; i < JOURNAL_PAGE_PNTS; i++) {
+        if (page.points[i] == JOURNAL_VOID) continue;
+        extremes.max = max(extremes.max, page.points[i]);
+        extremes.min = min(extremes.min, page.points[i]);
+    }
+    return extremes;
+}
+
+const JournalPage* HistoryPager::loadPage(uint32_t seq_page) {
+    uint8_t victim = 0;
+    uint32_t victim_distance = 0;
+
+    // Evicts the cached page farthest from the requested one, the viewport moves gradually
+    for (uint8_t i = 0; i < HIST_CACHE_PAGES; i++) {
+        if (_cached_pages[i] == seq_page) return &_cache[i];
+        uint32_t distance = (_cached_pages[i] == UINT32_MAX) ? UINT32_MAX
+                          : (_cached_pages[i] > seq_page) ? _cached_pages[i] - seq_page
+                          : seq_page - _cached_pages[i];
+        if (distance > victim_distance) {
+            victim = i;
+            victim_distance = distance;
+        }
+    }
+
+    JournalPage& page = _cache[victim];
+    _cached_pages[victim] = UINT32_MAX;
+    if (xSemaphoreTake(_bus_lock, portMAX_DELAY)) {
+        _eeprom.readBlock(_span.region_addr + (seq_page % _span.journal_pages) * EEPROM_PAGE_SIZE,
+                          reinterpret_cast<uint8_t*>(&page), sizeof(JournalPage));
+        xSemaphoreGive(_bus_lock);
+    }
+    if (findCRC16(page.points, sizeof(page.points)) != page.crc) return nullptr;
+
+    _cached_pages[victim] = seq_page;
+    return &page;
+}
@@ -0,0 +1,58 @@
+template <typename value_type, uint16_t capacity, uint8_t bucket_len>
+bool HistoryTier<value_type, capacity, bucket_len>::accumulate(const Aggregate<value_type>& sample) {
+    if (_bucket_count == 0) {
+        _bucket = sample;
+        _bucket_sum = 0;
+    } else {
+        _bucket.min = min(_bucket.min, sample.min);
+        _bucket.max = max(_bucket.max, sample.max);
+    }
+    _bucket_sum += sample.avg;
+
+    if (++_bucket_count < bucket_len) return false;
+
+    if constexpr (std::is_integral<value_type>::value) {
+        _bucket.avg = round(_bucket_sum / bucket_len);
+    } else {
+        _bucket.avg = _bucket_sum / bucket_len;
+    }
+    _mins.push(_bucket.min);
+    _avgs.push(_bucket.avg);
+    _maxs.push(_bucket.max);
+    _bucket_count = 0;
+    return true;
+}
+
+template <typename value_type, uint16_t capacity, uint8_t bucket_len>
+void HistoryTier<value_type, capacity, bucket_len>::clear() {
+    _mins.clear();
+    _avgs.clear();
+    _maxs.clear();
+    _bucket_count = 0;
+}
+
+template <typename value_type, uint16_t capacity, uint8_t bucket_len>
+Aggregate<value_type> HistoryTier<value_type, capacity, bucket_len>::getLast() const {
+    return {_mins.getLast(), _avgs.getLast(), _maxs.getLast()};
+}
+
+template <typename value_type, uint16_t capacity, uint8_t bucket_len>
+value_type HistoryTier<value_type, capacity, bucket_len>::getAverage(uint16_t index) const {
+    return _avgs[index];
+}
+
+template <typename value_type, uint16_t capacity, uint8_t bucket_len>
+Extremes<value_type> HistoryTier<value_type, capacity, bucket_len>::findExtremes(uint16_t startpoint,
+                                                                                 uint16_t endpoint) const {
+    return {_maxs.findExtremes(startpoint, endpoint).max, _mins.findExtremes(startpoint, endpoint).min};
+}
+
+template <typename value_type, uint16_t capacity, uint8_t bucket_len>
+uint16_t HistoryTier<value_type, capacity, bucket_len>::getCount() const {
+    return _avgs.getCount();
+}
+
+template <typename value_type, uint16_t capacity, uint8_t bucket_len>
+uint8_t HistoryTier<value_type, capacity, bucket_len>::getPending() const {
+    return _bucket_count;
+}
@@ -0,0 +1,54 @@
+template <typename item_type, uint16_t capacity>
+void RingBuffer<item_type, capacity>::push(const item_type& item) {
+    _items[_head] = item;
+    _head = (_head + 1 < capacity) ? _head + 1 : 0;
+
+    if (_count < capacity) {
+        _count++;
+    } else {
+        _tail = _head;
+    }
+}
+
+template <typename item_type, uint16_t capacity>
+void RingBuffer<item_type, capacity>::clear() {
+    _head = _tail = _count = 0;
+}
+
+template <typename item_type, uint16_t capacity>
+item_type& RingBuffer<item_type, capacity>::operator[](uint16_t index) {
+    return _items[toSlot(index)];
+}
+
+template <typename item_type, uint16_t capacity>
+const item_type& RingBuffer<item_type, capacity>::operator[](uint16_t index) const {
+    return _items[toSlot(index)];
+}
+
+template <typename item_type, uint16_t capacity>
+const item_type& RingBuffer<item_type, capacity>::getLast() const {
+    return _items[toSlot(_count - 1)];
+}
+
+template <typename item_type, uint16_t capacity>
+uint16_t RingBuffer<item_type, capacity>::getContiguous(uint16_t index, const item_type** items) const {
+    uint16_t slot = toSlot(index);
+    *items = &_items[slot];
+    return min(uint16_t(capacity - slot), uint16_t(_count - index));
+}
+
+template <typename item_type, uint16_t capacity>
+uint16_t RingBuffer<item_type, capacity>::getCount() const {
+    return _count;
+}
+
+template <typename item_type, uint16_t capacity>
+bool RingBuffer<item_type, capacity>::isFull() const {
+    return _count == capacity;
+}
+
+template <typename item_type, uint16_t capacity>
+uint16_t RingBuffer<item_type, capacity>::toSlot(uint16_t index) const {
+    uint16_t slot = _tail + index;
+    return (slot < capacity) ? slot : slot - capacity;
+}
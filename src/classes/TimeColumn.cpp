@@ -0,0 +1,35 @@
+#include <classes/TimeColumn.h>
+
+void TimeColumn::append(uint32_t epoch, uint16_t count) {
+    _append_count += count;
+    _last_epoch = epoch;
+}
+
+void TimeColumn::restore(uint16_t count, uint32_t epoch) {
+    _append_count = count;
+    _last_epoch = epoch;
+}
+
+Timestamp TimeColumn::getTimestamp(uint32_t backstep) const {
+    uint32_t epoch_min = _last_epoch / 60 - backstep;
+
+    // 1 January 1970 was a Thursday, weekdays count from Monday
+    Timestamp stamp;
+    stamp.weekday = (epoch_min / (24 * 60) + 3) % 7;
+    stamp.hour = epoch_min / 60 % 24;
+    stamp.minute = epoch_min % 60;
+    return stamp;
+}
+
+uint32_t TimeColumn::getCount() const {
+    return _append_count;
+}
+
+uint32_t TimeColumn::getEpoch() const {
+    return _last_epoch;
+}
+
+void TimeColumn::getCharTime(uint32_t backstep, char* buffer) const {
+    Timestamp stamp = getTimestamp(backstep);
+    sprintf(buffer, "%u:%02u", stamp.hour, stamp.minute);
+}
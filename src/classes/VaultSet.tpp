@@ -0,0 +1,220 @@
+template <typename... vault_types>
+VaultSet<vault_types...>::VaultSet(I2C_eeprom& eeprom_ref)
+    : _eeprom(eeprom_ref) {
+    static_assert(STAGE_PNTS_AMT <= JOURNAL_PAGE_PNTS, "Staged chunk must span at most two journal pages");
+    static_assert(((findJournalPages(vault_types::getCapacity()) * JOURNAL_PAGE_PNTS
+                    >= vault_types::getCapacity() + 2 * JOURNAL_PAGE_PNTS) && ...),
+                  "Vault capacities exceed the EEPROM backup space");
+    static_assert(findEnduranceYears() >= EEPROM_LIFE_YEARS, "Backup wears out EEPROM too early");
+    static_assert(findEmergencyCommitTime() <= HOLDUP_TIME, "Emergency backup outlasts the supply holdup");
+    static_assert(sizeof(VaultSet) <= VAULTS_RAM_BUDGET, "Vault capacities exceed the static RAM budget");
+
+    for (Extremes<int16_t>& page : _page_extremes) page = {JOURNAL_VOID, JOURNAL_VOID};
+}
+
+template <typename... vault_types>
+void VaultSet<vault_types...>::appendToVaults(uint32_t epoch) {
+    _emergency_ready = false;
+
+    // Only the outage measured at restore is filled, a clock adjustment just re-anchors the time column
+    uint16_t gap_count = _gap_count;
+    _gap_count = 0;
+
+    std::apply([&](auto&... vault) { (vault.appendToVault(gap_count), ...); }, _vaults);
+    _time.append(epoch, gap_count + 1);
+    _journal_pending = min((uint32_t) _journal_pending + gap_count + 1, (uint32_t) getCapacity());
+    restageEmergency();
+}
+
+template <typename... vault_types>
+bool VaultSet<vault_types...>::stageJournal(JournalStage& stage) const {
+    stage.seq = _journal_seq;
+    stage.epoch = _time.getEpoch();
+    stage.count = min(_journal_pending, (uint16_t) STAGE_PNTS_AMT);
+    stage.head_count = getHeadCount();
+    std::apply([&](const auto&... vault) {
+        uint8_t index = 0;
+        ((vault.stageJournal(stage.pages[index], findJournalPages(vault.getCapacity()), stage.seq, _journal_pending, stage.count), index++), ...);
+    }, _vaults);
+    return stage.count == _journal_pending;
+}
+
+template <typename... vault_types>
+void VaultSet<vault_types...>::writeJournal(const JournalStage& stage) const {
+    std::apply([&](const auto&... vault) {
+        uint16_t region_addr = getJournalAddr();
+        uint8_t index = 0;
+        ((vault.writeJournal(_eeprom, region_addr, findJournalPages(vault.getCapacity()), stage.seq,
+                             stage.pages[index], stage.count),
+          region_addr += findJournalPages(vault.getCapacity()) * EEPROM_PAGE_SIZE, index++), ...);
+    }, _vaults);
+}
+
+template <typename... vault_types>
+void VaultSet<vault_types...>::commitJournal(const JournalStage& stage) {
+    // The other backup task may have already restaged and committed the same chunk
+    if (stage.seq != _journal_seq) return;
+    if (stage.count) {
+        std::apply([&](const auto&... vault) {
+            uint16_t region_page = 0;
+            uint8_t index = 0;
+            auto refresh = [&](uint16_t journal_pages) {
+                uint32_t seq_page = stage.seq / JOURNAL_PAGE_PNTS;
+                uint32_t last_page = (stage.seq + stage.count - 1) / JOURNAL_PAGE_PNTS;
+                for (uint8_t i = 0; seq_page + i <= last_page; i++) {
+                    _page_extremes[region_page + (seq_page + i) % journal_pages] =
+                        HistoryPager::findPageExtremes(stage.pages[index][i]);
+                }
+            };
+            ((refresh(findJournalPages(vault.getCapacity())),
+              region_page += findJournalPages(vault.getCapacity()), index++), ...);
+        }, _vaults);
+    }
+    _journal_seq += stage.count;
+    _journal_pending -= stage.count;
+    restageEmergency();
+}
+
+template <typename... vault_types>
+bool VaultSet<vault_types...>::restoreVault(uint8_t channel, uint32_t seq, uint16_t head_count,
+                                            uint16_t miss_count) {
+    bool restored = false;
+    std::apply([&](auto&... vault) {
+        uint16_t region_addr = getJournalAddr();
+        uint8_t index = 0;
+        ((index++ == channel ? restored = vault.restoreJournal(_eeprom, region_addr,
+                                                               findJournalPages(vault.getCapacity()),
+                                                               seq, head_count, miss_count)
+                             : false,
+          region_addr += findJournalPages(vault.getCapacity()) * EEPROM_PAGE_SIZE), ...);
+    }, _vaults);
+    return restored;
+}
+
+template <typename... vault_types>
+void VaultSet<vault_types...>::finishRestore(uint32_t seq, uint32_t epoch, uint16_t miss_count) {
+    uint16_t count = 0;
+    std::apply([&](auto&... vault) { ((count = max(count, vault.getHeadCount())), ...); }, _vaults);
+    _time.restore(count, epoch);
+    _journal_seq = seq;
+    _journal_pending = 0;
+    _gap_count = min(miss_count, getCapacity());
+    restageEmergency();
+}
+
+template <typename... vault_types>
+void VaultSet<vault_types...>::indexJournalPage(uint16_t page) {
+    // Runs before appends start, so no commit can refresh the same entry meanwhile
+    JournalPage journal_page;
+    _eeprom.readBlock(getJournalAddr() + page * EEPROM_PAGE_SIZE, reinterpret_cast<uint8_t*>(&journal_page),
+                      sizeof(JournalPage));
+    _page_extremes[page] = HistoryPager::findPageExtremes(journal_page);
+}
+
+template <typename... vault_types>
+HistorySpan VaultSet<vault_types...>::findHistorySpan(uint8_t channel) const {
+    HistorySpan span = {};
+    std::apply([&](const auto&... vault) {
+        uint16_t region_addr = getJournalAddr();
+        uint8_t index = 0;
+        auto fill = [&](const auto& vault) {
+            uint16_t journal_pages = findJournalPages(vault.getCapacity());
+            uint32_t slots = (uint32_t) journal_pages * JOURNAL_PAGE_PNTS;
+            uint32_t ring_seq = _journal_seq + _journal_pending - vault.getHeadCount();
+
+            // Slots behind the last written page hold placeholders of the newest chunk
+            uint32_t first_seq = (_journal_seq + JOURNAL_PAGE_PNTS > slots)
+                                 ? _journal_seq + JOURNAL_PAGE_PNTS - slots : 0;
+
+            // The span starts at the sequence of graph index 0, the ring's oldest point when nothing is paged
+            span = {region_addr, journal_pages, ring_seq, 0,
+                    &_page_extremes[(region_addr - getJournalAddr()) / EEPROM_PAGE_SIZE]};
+            if (ring_seq <= _journal_seq && ring_seq > first_seq) {
+                span.first_seq = first_seq;
+                span.count = ring_seq - first_seq;
+            }
+        };
+        ((index++ == channel ? fill(vault) : void(),
+          region_addr += findJournalPages(vault.getCapacity()) * EEPROM_PAGE_SIZE), ...);
+    }, _vaults);
+    return span;
+}
+
+template <typename... vault_types>
+template <uint8_t channel>
+auto& VaultSet<vault_types...>::getVault() {
+    return std::get<channel>(_vaults);
+}
+
+template <typename... vault_types>
+template <typename visitor_type>
+void VaultSet<vault_types...>::visitVault(uint8_t channel, visitor_type visitor) {
+    std::apply([&](auto&... vault) {
+        uint8_t index = 0;
+        ((index++ == channel ? visitor(vault) : void()), ...);
+    }, _vaults);
+}
+
+template <typename... vault_types>
+const typename VaultSet<vault_types...>::JournalStage* VaultSet<vault_types...>::getEmergencyPayload() const {
+    return _emergency_ready ? &_emergency : nullptr;
+}
+
+template <typename... vault_types>
+const TimeColumn& VaultSet<vault_types...>::getTime() const {
+    return _time;
+}
+
+template <typename... vault_types>
+uint16_t VaultSet<vault_types...>::getHeadCount() const {
+    return min(_time.getCount(), (uint32_t) getCapacity());
+}
+
+template <typename... vault_types>
+constexpr uint8_t VaultSet<vault_types...>::getVaultCount() {
+    return sizeof...(vault_types);
+}
+
+template <typename... vault_types>
+constexpr uint16_t VaultSet<vault_types...>::getCapacity() {
+    uint16_t capacity = 0;
+    ((capacity = max(capacity, vault_types::getCapacity())), ...);
+    return capacity;
+}
+
+template <typename... vault_types>
+constexpr uint16_t VaultSet<vault_types...>::getJournalAddr() {
+    return LOG_SLOTS * LOG_RECORD_SIZE;
+}
+
+template <typename... vault_types>
+constexpr uint16_t VaultSet<vault_types...>::findJournalPages(uint16_t capacity) {
+    // The log keeps a fixed share, the rest is split by capacity to journal history past the RAM rings
+    uint32_t total_capacity = (0 + ... + (uint32_t) vault_types::getCapacity());
+    return (uint32_t) JOURNAL_PAGES * capacity / total_capacity;
+}
+
+template <typename... vault_types>
+constexpr float VaultSet<vault_types...>::findEnduranceYears() {
+    float flushes = 3600000.0f / STORE_PER;
+    float flush_pages = (float) STAGE_PNTS_AMT / JOURNAL_PAGE_PNTS + 1;
+    float log_pages = (float) getJournalAddr() / EEPROM_PAGE_SIZE;
+
+    // Page writes per hour on the most worn page of the log and of every journal region
+    float worst = flushes / log_pages;
+    ((worst = max(worst, flushes * flush_pages / findJournalPages(vault_types::getCapacity()))), ...);
+    return EEPROM_ENDURANCE / worst / (24 * 365);
+}
+
+template <typename... vault_types>
+constexpr uint16_t VaultSet<vault_types...>::findEmergencyCommitTime() {
+    // Up to two journal pages per vault and one log record page
+    return (2 * sizeof...(vault_types) + 1) * EEPROM_WRITE_TIME;
+}
+
+template <typename... vault_types>
+void VaultSet<vault_types...>::restageEmergency() {
+    // Pending points are kept encoded so a power loss costs only the page writes
+    _emergency_ready = false;
+    _emergency_ready = stageJournal(_emergency);
+}
@@ -1,78 +1,123 @@
 #include <config/Globals.h>
 
-void saveInt(uint16_t value, uint16_t* addr) {
-    eeprom.writeByte((*addr)++, (value >> 8) & 0xFF);
-    eeprom.writeByte((*addr)++, value & 0xFF);
-}
+void appendLogRecord(LogRecord& record, bool closed) {
+    record.closed = closed;
 
-uint16_t readInt(uint16_t* addr) {
-    uint8_t high_byte = eeprom.readByte((*addr)++);
-    uint8_t low_byte = eeprom.readByte((*addr)++);
-    return (high_byte << 8) | low_byte;
+    // The closing record goes out with every other task suspended, possibly in the middle of a bus transfer
+    if (closed) backup_log.append(record);
+    else if (xSemaphoreTake(i2c_lock, portMAX_DELAY)) {
+        backup_log.append(record);
+        xSemaphoreGive(i2c_lock);
+    }
 }
 
-void createRawBackup() {
-    uint16_t addr = 6;
+uint16_t flushJournal(station_vaults::JournalStage& stage) {
+    uint16_t lock_time = 0;
+    bool complete = false;
 
-    SAVE_BACKUP_STATE(false);
-    saveInt(out_temp.getHeadCount(), &addr);
-    for (auto& vault : vaults) {
-        vault->savePeriodicData(&addr);
+    while (!complete) {
+        if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
+            uint32_t start = micros();
+            complete = vaults.stageJournal(stage);
+            lock_time = max(lock_time, (uint16_t) min(micros() - start, (uint32_t) UINT16_MAX));
+            xSemaphoreGive(vault_lock);
+        }
+        if (xSemaphoreTake(i2c_lock, portMAX_DELAY)) {
+            vaults.writeJournal(stage);
+            xSemaphoreGive(i2c_lock);
+        }
+        if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
+            vaults.commitJournal(stage);
+            xSemaphoreGive(vault_lock);
+        }
     }
-    last_day_min = findMinutesOfDay(rtc.getHours(), rtc.getMinutes());
-    backup_ready = true;
+    return lock_time;
+}
+
+void createRawBackup() {
+    station_vaults::JournalStage stage;
+    LogRecord record = {};
+    record.lock_time = flushJournal(stage);
+    record.journal_seq = stage.seq + stage.count;
+    record.head_count = stage.head_count;
+    record.epoch = stage.epoch;
+    appendLogRecord(record, false);
 }
 
 void finalizeBackup() {
-    if (READ_BACKUP_STATE()) return;
-    uint16_t year_day = findDayOfYear(rtc.getMonth(), rtc.getDay());
-    uint16_t day_min = findMinutesOfDay(rtc.getHours(), rtc.getMinutes());
-    uint8_t elapsed_time = findDayMinutesDifference(day_min, last_day_min);
-    uint8_t emergency_data_count = backup_ready ? (elapsed_time / APD_PER_S) : 0;
+    const LogRecord* newest = backup_log.getNewest();
+    if ((newest && newest->closed) || !uxSemaphoreGetCount(restore_done)) return;
 
-    uint16_t addr = 1;
-    saveInt(year_day, &addr);
-    saveInt(day_min, &addr);
-    eeprom.writeByte(addr++, emergency_data_count);
-    if (emergency_data_count) {
-        for (auto& vault : vaults) {
-            vault->saveEmergencyData(emergency_data_count);
-        }
-    } else if (!backup_ready) {
-        saveInt(out_temp.getHeadCount(), &addr);
-        for (auto& vault : vaults) {
-            vault->savePeriodicData(&addr);
-        }
+    LogRecord record = {};
+    const station_vaults::JournalStage* payload = vaults.getEmergencyPayload();
+    if (payload) {
+        // Every other vault task is suspended by now, the pre-encoded pages go out as they are
+        vaults.writeJournal(*payload);
+        record.journal_seq = payload->seq + payload->count;
+        record.head_count = payload->head_count;
+        record.epoch = payload->epoch;
+        vaults.commitJournal(*payload);
+    } else {
+        // Nothing may wait here, a suspended task can hold either lock for good, the last record stays then
+        station_vaults::JournalStage stage;
+        if (!xSemaphoreTake(vault_lock, 0)) return;
+        bool complete = vaults.stageJournal(stage);
+        xSemaphoreGive(vault_lock);
+        if (!complete || !xSemaphoreTake(i2c_lock, 0)) return;
+        vaults.writeJournal(stage);
+        xSemaphoreGive(i2c_lock);
+        vaults.commitJournal(stage);
+        record.journal_seq = stage.seq + stage.count;
+        record.head_count = stage.head_count;
+        record.epoch = stage.epoch;
     }
-    SAVE_BACKUP_STATE(true);
+    record.commit_time = micros() - power_fail_time;
+    appendLogRecord(record, true);
 }
 
-void restoreAuxiliaryData(uint16_t &addr, uint32_t &elapsed_time, uint16_t &periodic_cnt,
-                          uint8_t &emergency_cnt, uint16_t &missing_cnt, uint16_t &start_index) {
-    uint16_t curr_year_day = findDayOfYear(rtc.getMonth(), rtc.getDay());
-    uint16_t curr_day_min = findMinutesOfDay(rtc.getHours(), rtc.getMinutes());
-    elapsed_time = findYearMinutesDifference(curr_year_day, curr_day_min,
-                                             readInt(&addr), readInt(&addr));
+void restoreAuxiliaryData(const LogRecord& record, uint32_t &elapsed_time, uint16_t &missing_cnt,
+                          uint32_t &restore_epoch) {
+    // A clock stepped back by DST or the host counts as no outage, the history is kept and re-anchored
+    uint32_t curr_epoch = rtc.getEpoch();
+    restore_epoch = min(record.epoch, curr_epoch);
+    elapsed_time = (curr_epoch - restore_epoch) / 60;
+    missing_cnt = min(elapsed_time / APD_PER_S, (uint32_t) UINT16_MAX);
+}
 
-    emergency_cnt = eeprom.readByte(addr++);
-    periodic_cnt = readInt(&addr);
-    missing_cnt = elapsed_time / APD_PER_S;
-    uint16_t total_count = periodic_cnt + emergency_cnt + missing_cnt;
-    start_index = (total_count > DATA_PNTS_AMT) ? total_count - DATA_PNTS_AMT : 0;
+void awaitRestore() {
+    // The semaphore is given once the vaults are restored and then only passed through
+    if (xSemaphoreTake(restore_done, portMAX_DELAY)) xSemaphoreGive(restore_done);
 }
 
 void pullBackup() {
-    uint16_t addr = 1;
+    const LogRecord* newest = backup_log.getNewest();
     uint32_t elapsed_time;
-    uint16_t periodic_cnt, missing_cnt, start_idx;
-    uint8_t emergency_cnt;
-    uint8_t curr_wday = rtc.getWeekDay(), curr_hour = rtc.getHours(), curr_min = rtc.getMinutes();
+    uint16_t missing_cnt;
+    uint32_t restore_epoch;
 
-    restoreAuxiliaryData(addr, elapsed_time, periodic_cnt, emergency_cnt, missing_cnt, start_idx);
-    if (elapsed_time < DATA_PNTS_AMT * APD_PER_S) {
-        for (auto& vault : vaults) {
-            vault->restorePointsData(&addr, start_idx, periodic_cnt, emergency_cnt, missing_cnt);
-            vault->assignTimestamps(curr_wday, curr_hour, curr_min);
+    restoreAuxiliaryData(*newest, elapsed_time, missing_cnt, restore_epoch);
+    if (elapsed_time >= (uint32_t) vaults.getCapacity() * APD_PER_S) return;
+
+    // Channels go one at a time in screen order, so the outdoor ones shown on the main screen come first
+    for (uint8_t channel = 0; channel < vaults.getVaultCount(); channel++) {
+        if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
+            if (xSemaphoreTake(i2c_lock, portMAX_DELAY)) {
+                vaults.restoreVault(channel, newest->journal_seq, newest->head_count, missing_cnt);
+                xSemaphoreGive(i2c_lock);
+            }
+            xSemaphoreGive(vault_lock);
         }
     }
-}
\ No newline at end of file
+    if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
+        vaults.finishRestore(newest->journal_seq, restore_epoch, missing_cnt);
+        xSemaphoreGive(vault_lock);
+    }
+
+    // Extremes of the restored journal pages, the bus is released between pages for the sensor reads
+    for (uint16_t page = 0; page < JOURNAL_PAGES; page++) {
+        if (xSemaphoreTake(i2c_lock, portMAX_DELAY)) {
+            vaults.indexJournalPage(page);
+            xSemaphoreGive(i2c_lock);
+        }
+    }
+}
@@ -77,18 +77,25 @@ void updateConnectionStatus(state_config& state) {
 }
 
 void buildMainScreen(state_config& state) {
+    float temp = 0, hum = 0;
+    if (xSemaphoreTake(i2c_lock, portMAX_DELAY)) {
+        temp = bme.readTemperature();
+        hum = bme.readHumidity();
+        xSemaphoreGive(i2c_lock);
+    }
+
     drawIcon(indoor_icon);
     updateIndicator(out_temp.getLastValue(), out_temp_ind, true);
     updateIndicator(out_hum.getLastValue(), out_hum_ind, true);
     updateIndicator(out_press.getLastValue(), out_press_ind, true);
-    updateIndicator(bme.readTemperature(), in_temp_ind, true);
-    updateIndicator(bme.readHumidity(), in_hum_ind, true);
+    updateIndicator(temp, in_temp_ind, true);
+    updateIndicator(hum, in_hum_ind, true);
     updateIndicator(mhz.readCO2(false), co2_rate_ind, true);
     updateIndicator(weekdays[rtc.getWeekDay() - 1], weekday_ind, true);
 
-    int8_t rate = findWeatherRating(out_press.findNormalizedTrendSlope(BACKSTEP_PER),
-                                    out_hum.findNormalizedTrendSlope(BACKSTEP_PER),
-                                    out_temp.findNormalizedTrendSlope(BACKSTEP_PER));
+    int8_t rate = findWeatherRating(out_press.findNormalizedTrendSlope(PRESS_NORM_RANGE),
+                                    out_hum.findNormalizedTrendSlope(HUM_NORM_RANGE),
+                                    out_temp.findNormalizedTrendSlope(TEMP_NORM_RANGE));
     updateWeatherIcon(rate, state, true);
     updateConnectionIcon(state.radio_status, true);
     updateTime(rtc.getMinutes());
@@ -5,6 +5,8 @@ void tftSetup() {
     digitalWrite(TFT_LED, HIGH);
     tft.begin();
     tft.setRotation(3);
+    // Panel lines run right to left in this rotation, the fixed left part of the graph is the bottom margin
+    tft.setScrollMargins(0, L_EDGE);
     tft.cp437(true);
 }
 
@@ -24,7 +26,8 @@ void rtcSetup() {
 
 void eepromSetup() {
     eeprom.begin();
-    eeprom.setPageSize(64);
+    I2C.setClock(I2C_CLOCK);
+    eeprom.setPageSize(EEPROM_PAGE_SIZE);
 }
 
 void hardwareSetup() {
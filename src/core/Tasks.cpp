@@ -7,6 +7,7 @@
 void pollPower(void*) {
     for (;;) {
         if (!digitalRead(POW)) {
+            power_fail_time = micros();
             digitalWrite(TFT_LED, LOW);
             for (int8_t i = 0; i < NUM_TASKS; i++) {
                 if (i != POWER_TASK && i != EMERGENCY_BACKUP_TASK
@@ -109,10 +110,7 @@ void pollRTCEvents(void*) {
 void emergencyBackup(void*) {
     ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
     digitalWrite(LED, HIGH);
-    if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
-        finalizeBackup();
-        xSemaphoreGive(vault_lock);
-    }
+    finalizeBackup();
     for (int8_t i = 0; i < NUM_TASKS; i++) {
         if (i != POWER_TASK && i != EMERGENCY_BACKUP_TASK
             && eTaskGetState(tasks[i]) == eSuspended) {
@@ -124,34 +122,42 @@ void emergencyBackup(void*) {
 }
 
 void periodicBackup(void*) {
-    vTaskDelay(pdMS_TO_TICKS(STORE_PER));
-    TickType_t last_wakeup = xTaskGetTickCount();
+    awaitRestore();
     for (;;) {
-        if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
-            createRawBackup();
-            xSemaphoreGive(vault_lock);
-        }
-        vTaskDelayUntil(&last_wakeup, pdMS_TO_TICKS(STORE_PER));
+        // An append leaving more pending points than the emergency payload holds wakes the flush early
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(STORE_PER));
+        createRawBackup();
+    }
+}
+
+void restoreBackup(void*) {
+    digitalWrite(LED, HIGH);
+    pullBackup();
+    xSemaphoreGive(restore_done);
+    if (xSemaphoreTake(state_lock, portMAX_DELAY)) {
+        if (state.curr_screen == MAIN && state.curr_mode == SCROLLING) state.setup = true;
+        xSemaphoreGive(state_lock);
     }
+    digitalWrite(LED, LOW);
+    vTaskDelete(NULL);
 }
 
 void dataAppend(void*) {
+    awaitRestore();
     vTaskDelay(pdMS_TO_TICKS(APD_PER));
     TickType_t last_wakeup = xTaskGetTickCount();
     for (;;) {
-        uint8_t weekday = rtc.getWeekDay() - 1;
-        uint8_t hour = rtc.getHours();
-        uint8_t minute = rtc.getMinutes();
+        uint32_t epoch = rtc.getEpoch();
+        bool stale = false;
 
         if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
-            for (auto& vault : vaults) {
-                vault->appendToVault(weekday, hour, minute);
-            }
+            vaults.appendToVaults(epoch);
+            stale = !vaults.getEmergencyPayload();
             if (xSemaphoreTake(state_lock, portMAX_DELAY)) {
                 if (state.curr_screen == MAIN) {
-                    int8_t rate = findWeatherRating(out_press.findNormalizedTrendSlope(BACKSTEP_PER),
-                                                    out_hum.findNormalizedTrendSlope(BACKSTEP_PER),
-                                                    out_temp.findNormalizedTrendSlope(BACKSTEP_PER));
+                    int8_t rate = findWeatherRating(out_press.findNormalizedTrendSlope(PRESS_NORM_RANGE),
+                                                    out_hum.findNormalizedTrendSlope(HUM_NORM_RANGE),
+                                                    out_temp.findNormalizedTrendSlope(TEMP_NORM_RANGE));
                     xSemaphoreGive(vault_lock);
                     updateWeatherIcon(rate, state, false);
                 }
@@ -159,6 +165,7 @@ void dataAppend(void*) {
             }
             xSemaphoreGive(vault_lock);
         }
+        if (stale) xTaskNotifyGive(tasks[PERIODIC_BACKUP_TASK]);
         vTaskDelayUntil(&last_wakeup, pdMS_TO_TICKS(APD_PER));
     }
 }
@@ -167,8 +174,13 @@ void dataUpdate(void*) {
     vTaskDelay(pdMS_TO_TICKS(UPD_PER));
     TickType_t last_wakeup = xTaskGetTickCount();
     for (;;) {
-        float temp = bme.readTemperature();
-        float hum = bme.readHumidity();
+        // The sensor shares the bus with the backup EEPROM
+        float temp = 0, hum = 0;
+        if (xSemaphoreTake(i2c_lock, portMAX_DELAY)) {
+            temp = bme.readTemperature();
+            hum = bme.readHumidity();
+            xSemaphoreGive(i2c_lock);
+        }
         uint16_t ppm = mhz.readCO2(true);
 
         if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
@@ -199,7 +211,17 @@ void plotUpdate(void*) {
             uint32_t curr_time = millis();
             uint16_t curr_head_count;
             if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
-                curr_head_count = out_temp.getHeadCount();
+                curr_head_count = vaults.getHeadCount();
+
+                // A view that can't keep its samples after a journal commit is drawn again in the same mode
+                if (plot && state.curr_screen != MAIN
+                    && plot->setHistory(vaults.findHistorySpan(state.curr_screen - 1))) {
+                    if (state.curr_mode == SCROLLING) {
+                        delete plot;
+                        plot = nullptr;
+                    }
+                    state.setup = true;
+                }
                 xSemaphoreGive(vault_lock);
             }
 
@@ -210,14 +232,10 @@ void plotUpdate(void*) {
                         tft.fillScreen(0x0000);
                         if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
                             if (state.curr_screen != MAIN) {
-                                switch (state.curr_screen) {
-                                    case OUT_TEMP: plot = new Graph<float>(out_temp, tft); break;
-                                    case OUT_HUM: plot = new Graph<float>(out_hum, tft); break;
-                                    case OUT_PRESS: plot = new Graph<float>(out_press, tft); break;
-                                    case IN_TEMP: plot = new Graph<float>(in_temp, tft); break;
-                                    case IN_HUM: plot = new Graph<float>(in_hum, tft); break;
-                                    case CO2_RATE: plot = new Graph<uint16_t>(co2_rate, tft); break;
-                                }
+                                vaults.visitVault(state.curr_screen - 1, [](auto& vault) {
+                                    plot = new Graph(vault, vaults.getTime(), eeprom, i2c_lock,
+                                                     vaults.findHistorySpan(state.curr_screen - 1), tft, tftSPI);
+                                });
                                 plot->drawFresh();
                                 plot->drawLogos(state.curr_screen, state.curr_mint);
                                 plot->annotate();
@@ -266,7 +284,16 @@ void plotUpdate(void*) {
                     }
 
                     if (xSemaphoreTake(enc_event, 0)) {
-                        if (enc.turn()) {
+                        if (enc.turnH()) {
+                            if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
+                                if (plot->shiftTier(enc.dir())) {
+                                    plot->drawFresh(false);
+                                    plot->drawLogos(state.curr_screen, state.summertemp);
+                                    plot->annotate();
+                                }
+                                xSemaphoreGive(vault_lock);
+                            }
+                        } else if (enc.turn()) {
                             int8_t step = ((enc.fast()) ? PAN_FAST : PAN_SLOW) * enc.dir();
                             if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
                                 plot->dynamicPan(step);
@@ -275,10 +302,15 @@ void plotUpdate(void*) {
                         } else if (enc.click()) {
                             state.curr_mode = CURSOR;
                             state.setup = true;
+                            if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
+                                plot->resetTier();
+                                xSemaphoreGive(vault_lock);
+                            }
                         } else if (enc.hold()) {
                             while(enc.holding()) enc.tick();
                             state.curr_mode = SCROLLING;
                             if (xSemaphoreTake(vault_lock, portMAX_DELAY)) {
+                                plot->resetTier();
                                 plot->drawLocal();
                                 plot->drawLogos(state.curr_screen, state.summertemp);
                                 plot->annotate();
@@ -286,7 +318,7 @@ void plotUpdate(void*) {
                             }
                         }
                         xSemaphoreGive(enc_release);
-                    }
+                    } else plot->prefetch();
                 }
                 break;
                 case CURSOR: {
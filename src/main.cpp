@@ -17,44 +17,37 @@ RF24 radio(RF_CE, RF_CSN);
 I2C_eeprom eeprom(0x50, I2C_DEVICESIZE_24LC256, &I2C);
 STM32RTC& rtc = STM32RTC::getInstance();
 
-DataVault <float> out_temp(TEMP_NORM_RANGE, eeprom);
-DataVault <float> out_hum(HUM_NORM_RANGE, eeprom);
-DataVault <float> out_press(PRESS_NORM_RANGE, eeprom);
-DataVault <float> in_temp(eeprom);
-DataVault <float> in_hum(eeprom);
-DataVault <uint16_t> co2_rate(eeprom);
+station_vaults vaults(eeprom);
+BackupLog backup_log(eeprom, station_vaults::getJournalAddr() / LOG_RECORD_SIZE);
+#define CHANNEL_REF(screen, vault, type, points, storage) \
+    DataVault<type, points, storage<type>>& vault = vaults.getVault<screen - 1>();
+CHANNELS(CHANNEL_REF)
 
 GraphBase* plot = nullptr;
-VaultBase* vaults[] = {
-    &out_temp, &out_hum, &out_press,
-    &in_temp, &in_hum,
-    &co2_rate
-};
-
-uint16_t last_day_min;
-bool backup_ready = false;
 
 state_config state;
 SemaphoreHandle_t enc_event, enc_release;
-SemaphoreHandle_t state_lock, vault_lock;
+SemaphoreHandle_t state_lock, vault_lock, i2c_lock, restore_done;
 TaskHandle_t tasks[NUM_TASKS] = {NULL};
+volatile uint32_t power_fail_time = 0;
 
 
 void setup() {
     hardwareSetup();
 
-    if (READ_BACKUP_STATE()) {
-        digitalWrite(LED, HIGH);
-        tft.fillScreen(0x0000);
-        pullBackup();
-        digitalWrite(LED, LOW);
-    }
-
     enc_event = xSemaphoreCreateBinary();
     enc_release = xSemaphoreCreateBinary();
+    restore_done = xSemaphoreCreateBinary();
 
     state_lock = xSemaphoreCreateMutex();
     vault_lock = xSemaphoreCreateMutex();
+    i2c_lock = xSemaphoreCreateMutex();
+
+    if (backup_log.scan()) {
+        xTaskCreate(restoreBackup, "BackupRestore", 1024, NULL, 1, NULL);
+    } else {
+        xSemaphoreGive(restore_done);
+    }
 
     xTaskCreate(pollPower, "PowerPinPolling", 128, NULL, 4, &tasks[POWER_TASK]);
     xTaskCreate(pollEncoder, "EncoderPolling", 128, NULL, 4, &tasks[ENC_TASK]);
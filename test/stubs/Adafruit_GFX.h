@@ -0,0 +1,133 @@
+#ifndef Adafruit_GFX_h
+#define Adafruit_GFX_h
+
+// Host stand-in for Adafruit GFX. Shapes go through drawPixel, rounded corners are drawn square.
+// Text is not rasterized, printed strings are logged with their cursor instead.
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+
+typedef struct {
+    uint16_t bitmapOffset;
+    uint8_t width, height, xAdvance;
+    int8_t xOffset, yOffset;
+} GFXglyph;
+
+typedef struct {
+    uint8_t* bitmap;
+    GFXglyph* glyph;
+    uint16_t first, last;
+    uint8_t yAdvance;
+} GFXfont;
+
+struct PrintedText {
+    int16_t x, y;
+    std::string text;
+};
+
+class Adafruit_GFX {
+public:
+    std::vector<PrintedText> printed;
+
+    virtual ~Adafruit_GFX() {}
+
+    virtual void drawPixel(int16_t, int16_t, uint16_t) {}
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        if (w < 0) {
+            x += w + 1;
+            w = -w;
+        }
+        if (h < 0) {
+            y += h + 1;
+            h = -h;
+        }
+        for (int16_t j = y; j < y + h; j++) {
+            for (int16_t i = x; i < x + w; i++) drawPixel(i, j, color);
+        }
+    }
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { fillRect(x, y, w, 1, color); }
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { fillRect(x, y, 1, h, color); }
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        drawFastHLine(x, y, w, color);
+        drawFastHLine(x, y + h - 1, w, color);
+        drawFastVLine(x, y, h, color);
+        drawFastVLine(x + w - 1, y, h, color);
+    }
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+        int16_t dx = abs(x1 - x0), dy = -abs(y1 - y0);
+        int16_t sx = (x0 < x1) ? 1 : -1, sy = (y0 < y1) ? 1 : -1;
+        int16_t error = dx + dy;
+        for (;;) {
+            drawPixel(x0, y0, color);
+            if (x0 == x1 && y0 == y1) break;
+            int16_t doubled = 2 * error;
+            if (doubled >= dy) {
+                error += dy;
+                x0 += sx;
+            }
+            if (doubled <= dx) {
+                error += dx;
+                y0 += sy;
+            }
+        }
+    }
+    void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t, uint16_t color) {
+        drawRect(x, y, w, h, color);
+    }
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t, uint16_t color) {
+        fillRect(x, y, w, h, color);
+    }
+    void fillScreen(uint16_t color) { fillRect(0, 0, width(), height(), color); }
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t* bitmap, int16_t w, int16_t h) {
+        for (int16_t j = 0; j < h; j++) {
+            for (int16_t i = 0; i < w; i++) drawPixel(x + i, y + j, bitmap[j * w + i]);
+        }
+    }
+    virtual int16_t width() const { return 0; }
+    virtual int16_t height() const { return 0; }
+
+    void setTextColor(uint16_t) {}
+    void setTextSize(uint8_t) {}
+    void setFont(const GFXfont* font = nullptr) { _font = font; }
+    void setCursor(int16_t x, int16_t y) {
+        _cursor_x = x;
+        _cursor_y = y;
+    }
+    size_t print(const char* text) {
+        printed.push_back({_cursor_x, _cursor_y, text});
+        return strlen(text);
+    }
+
+    // Classic font cells are 6x8 with the cursor on the top left, custom fonts advance per glyph
+    void getTextBounds(const char* text, int16_t x, int16_t y, int16_t* x1, int16_t* y1, uint16_t* w,
+                       uint16_t* h) {
+        *x1 = x;
+        *y1 = y;
+        *w = 0;
+        *h = 8;
+        for (const char* c = text; *c; c++) {
+            if (!_font) *w += 6;
+            else if ((uint8_t) *c >= _font->first && (uint8_t) *c <= _font->last) {
+                *w += _font->glyph[(uint8_t) *c - _font->first].xAdvance;
+            }
+        }
+        if (_font) {
+            *y1 = y - _font->yAdvance;
+            *h = _font->yAdvance;
+        }
+    }
+
+protected:
+    const GFXfont* _font = nullptr;
+    int16_t _cursor_x = 0, _cursor_y = 0;
+};
+
+class GFXcanvas1 : public Adafruit_GFX {
+public:
+    GFXcanvas1(uint16_t, uint16_t) {}
+    bool getPixel(int16_t, int16_t) const { return false; }
+};
+
+#endif
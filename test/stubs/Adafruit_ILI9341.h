@@ -0,0 +1,48 @@
+#ifndef Adafruit_ILI9341_h
+#define Adafruit_ILI9341_h
+
+// Panel in rotation 3 kept as a framebuffer, fed by GFX calls and by raw pixel blocks sent over SPI
+
+#include <Adafruit_GFX.h>
+#include <SPI.h>
+
+class Adafruit_ILI9341 : public Adafruit_GFX {
+public:
+    static constexpr int16_t panel_width = 320, panel_height = 240;
+    uint16_t frame[panel_height][panel_width] = {};
+
+    Adafruit_ILI9341(SPIClass* spi, int, int, int) {
+        spi->sink = [this](const uint8_t* bytes, size_t count) {
+            // The controller takes big-endian pixels and fills the address window row by row
+            for (size_t i = 0; i + 1 < count; i += 2) {
+                drawPixel(_window_x + _window_pos % _window_w, _window_y + _window_pos / _window_w,
+                          (bytes[i] << 8) | bytes[i + 1]);
+                _window_pos++;
+            }
+        };
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if (x >= 0 && x < panel_width && y >= 0 && y < panel_height) frame[y][x] = color;
+    }
+    int16_t width() const override { return panel_width; }
+    int16_t height() const override { return panel_height; }
+
+    void startWrite() {}
+    void endWrite() {}
+    void setAddrWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+        _window_x = x;
+        _window_y = y;
+        _window_w = max(w, (uint16_t) 1);
+        _window_pos = 0;
+    }
+    void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+    void scrollTo(uint16_t) {}
+
+private:
+    int16_t _window_x = 0, _window_y = 0;
+    uint16_t _window_w = 1;
+    uint32_t _window_pos = 0;
+};
+
+#endif
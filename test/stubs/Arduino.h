@@ -0,0 +1,39 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+// Host stand-in for the STM32 Arduino core, only what the vault and graph classes use
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <type_traits>
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define DEC 10
+#define PI 3.1415926535897932384626433832795
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline uint32_t micros() {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline uint32_t millis() {
+    return micros() / 1000;
+}
+
+inline char* itoa(int value, char* buffer, int) {
+    sprintf(buffer, "%d", value);
+    return buffer;
+}
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef I2C_eeprom_h
+#define I2C_eeprom_h
+
+// 24LC256 kept in host memory, erased to 0xFF like a blank part
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#define I2C_DEVICESIZE_24LC256 32768
+
+class I2C_eeprom {
+public:
+    uint8_t mem[I2C_DEVICESIZE_24LC256];
+
+    I2C_eeprom(uint8_t, uint32_t, TwoWire*) { memset(mem, 0xFF, sizeof(mem)); }
+
+    int writeBlock(uint16_t addr, const uint8_t* buffer, uint16_t length) {
+        memcpy(mem + addr, buffer, length);
+        return 0;
+    }
+    uint16_t readBlock(uint16_t addr, uint8_t* buffer, uint16_t length) {
+        memcpy(buffer, mem + addr, length);
+        return length;
+    }
+};
+
+#endif
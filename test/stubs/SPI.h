@@ -0,0 +1,21 @@
+#ifndef SPI_h
+#define SPI_h
+
+#include <Arduino.h>
+#include <functional>
+
+class SPIClass {
+public:
+    // Receives every transferred byte, the display stand-in hooks its framebuffer here
+    std::function<void(const uint8_t*, size_t)> sink;
+
+    SPIClass(int, int, int) {}
+
+    void transfer(void* buffer, size_t count) {
+        if (sink) sink(static_cast<const uint8_t*>(buffer), count);
+        // MISO is not connected, the buffer comes back as idle-high bytes
+        memset(buffer, 0xFF, count);
+    }
+};
+
+#endif
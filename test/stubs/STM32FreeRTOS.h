@@ -0,0 +1,19 @@
+#ifndef STM32FreeRTOS_h
+#define STM32FreeRTOS_h
+
+// Host tests run single-threaded, so every lock is free
+
+#include <Arduino.h>
+
+typedef void* SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+
+#define portMAX_DELAY 0xFFFFFFFF
+#define pdTRUE 1
+#define pdFALSE 0
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return nullptr; }
+inline int xSemaphoreTake(SemaphoreHandle_t, TickType_t) { return pdTRUE; }
+inline int xSemaphoreGive(SemaphoreHandle_t) { return pdTRUE; }
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef Wire_h
+#define Wire_h
+
+#include <Arduino.h>
+
+class TwoWire {
+public:
+    TwoWire(int, int) {}
+};
+
+#endif
@@ -0,0 +1,70 @@
+#include <unity.h>
+#include <chrono>
+
+#include <classes/DataVault.h>
+
+// Append cost of a full vault per capacity, next to the shift-on-append storage the ring replaced
+
+static constexpr uint32_t BENCH_APPENDS = 200000;
+static constexpr uint8_t BENCH_RUNS = 5;
+
+template <uint16_t capacity>
+struct ShiftedHistory {
+    int16_t items[capacity];
+    uint16_t count = 0;
+
+    void push(int16_t value) {
+        if (count == capacity) memmove(items, items + 1, (capacity - 1) * sizeof(int16_t));
+        else count++;
+        items[count - 1] = value;
+    }
+};
+
+template <typename append_type>
+double findAppendNs(append_type append) {
+    double best = 1e9;
+    for (uint8_t run = 0; run < BENCH_RUNS; run++) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < BENCH_APPENDS; i++) append(i);
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        best = min(best, elapsed.count() / BENCH_APPENDS);
+    }
+    return best;
+}
+
+template <uint16_t capacity>
+double benchCapacity() {
+    static DataVault<float, capacity> vault;
+    static ShiftedHistory<capacity> shifted;
+    auto append = [](uint32_t i) {
+        vault.appendToAverage((i % 97) * 0.1f);
+        vault.appendToVault();
+    };
+    for (uint32_t i = 0; i < capacity; i++) append(i);
+    TEST_ASSERT_EQUAL_INT(capacity, vault.getHeadCount());
+
+    double ring_ns = findAppendNs(append);
+    double shift_ns = findAppendNs([](uint32_t i) { shifted.push(i); });
+    printf("capacity %5u: ring vault append %6.1f ns, shifted history append %8.1f ns\n",
+           capacity, ring_ns, shift_ns);
+    return ring_ns;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_append_cost_is_flat() {
+    double smallest = benchCapacity<240>();
+    benchCapacity<DATA_PNTS_AMT>();
+    benchCapacity<4 * DATA_PNTS_AMT>();
+    double largest = benchCapacity<10 * DATA_PNTS_AMT>();
+
+    // The shifted history grows with capacity, the margin here only absorbs timer noise
+    TEST_ASSERT_LESS_OR_EQUAL(3 * smallest, largest);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_append_cost_is_flat);
+    return UNITY_END();
+}
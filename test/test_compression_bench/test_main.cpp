@@ -0,0 +1,115 @@
+#include <unity.h>
+#include <chrono>
+#include <random>
+
+// Block internals are read to report the achieved bit rate
+#define private public
+#include <classes/DataVault.h>
+#undef private
+
+// Compression ratio and decode throughput of the pressure ring. The repository ships no sensor
+// recordings, so the series are seeded synthetic stand-ins shaped like the station's channels.
+
+typedef CompressedRing<int16_t, 3 * DATA_PNTS_AMT> pressure_ring;
+typedef ExtremaRing<int16_t, DATA_PNTS_AMT> plain_ring;
+
+static constexpr uint8_t DECODE_RUNS = 20;
+
+template <typename source_type>
+void benchSeries(const char* name, source_type next_value, bool reaches_capacity) {
+    static pressure_ring ring;
+    static int16_t pushed[4 * 3 * DATA_PNTS_AMT];
+    ring.clear();
+
+    std::mt19937 rng(7);
+    uint16_t pushed_count = sizeof(pushed) / sizeof(pushed[0]);
+    for (uint16_t i = 0; i < pushed_count; i++) {
+        pushed[i] = next_value(rng);
+        ring.push(pushed[i]);
+    }
+
+    uint32_t bits = 0, deltas = 0;
+    float worst_bits = 0;
+    for (uint16_t i = 0; i < ring._blocks.getCount(); i++) {
+        const CompressedBlock<int16_t>& block = ring._blocks[i];
+        bits += block.bit_count;
+        deltas += block.count - 1;
+        if (block.count == CMPR_BLOCK_LEN || i + 1 < ring._blocks.getCount()) {
+            worst_bits = max(worst_bits, (float) block.bit_count / max(block.count - 1, 1));
+        }
+    }
+
+    // Every held point decodes to the pushed value
+    uint16_t count = ring.getCount();
+    for (uint16_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_INT(pushed[pushed_count - count + i], ring[i]);
+    }
+
+    int32_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint8_t run = 0; run < DECODE_RUNS; run++) {
+        for (uint16_t i = 0; i < count; i++) checksum += ring[i];
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    TEST_ASSERT_TRUE(checksum != INT32_MIN);
+
+    // Points past the capacity are encoded but hidden, the ring is sized for the worst block bit rate
+    float encoded_depth = (float) ring._count / DATA_PNTS_AMT;
+    float density = (count / (float) sizeof(pressure_ring)) / (DATA_PNTS_AMT / (float) sizeof(plain_ring));
+    printf("%-18s %5.2f bits/point, worst block %5.2f, encoded %4.2fx depth, usable %4u points at %4.2fx "
+           "points per byte, decode %5.1f Mpoints/s\n", name, (float) bits / max(deltas, (uint32_t) 1), worst_bits,
+           encoded_depth, count, density, count * DECODE_RUNS / elapsed.count() / 1e6);
+
+    if (reaches_capacity) TEST_ASSERT_EQUAL_INT(3 * DATA_PNTS_AMT, count);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_pressure_drift() {
+    float pressure = 755;
+    benchSeries("pressure drift", [&](std::mt19937& rng) {
+        pressure += ((int) (rng() % 7) - 3) * 0.05f;
+        return (int16_t) lround(pressure * 10);
+    }, true);
+}
+
+void test_noisy_pressure() {
+    float pressure = 755;
+    benchSeries("noisy pressure", [&](std::mt19937& rng) {
+        pressure += ((int) (rng() % 7) - 3) * 0.05f;
+        return (int16_t) lround((pressure + ((int) (rng() % 3) - 1) * 0.1f) * 10);
+    }, true);
+}
+
+// The remaining channels stay uncompressed, they are reported for comparison only
+void test_temperature_cycle() {
+    uint32_t i = 0;
+    benchSeries("temperature cycle", [&](std::mt19937& rng) {
+        float temp = 10 + 8 * sin(2 * PI * i++ / (24 * 60 / APD_PER_S)) + ((int) (rng() % 5) - 2) * 0.1f;
+        return (int16_t) lround(temp * 10);
+    }, false);
+}
+
+void test_co2_level() {
+    int16_t ppm = 600;
+    benchSeries("co2 level", [&](std::mt19937& rng) {
+        ppm = constrain(ppm + (int) (rng() % 41) - 20, 400, 2000);
+        return ppm;
+    }, false);
+}
+
+void test_white_noise() {
+    // Every point takes a raw escape, the ring falls short of its capacity
+    benchSeries("white noise", [](std::mt19937& rng) { return (int16_t) (rng() % 60001 - 30000); }, false);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_pressure_drift);
+    RUN_TEST(test_noisy_pressure);
+    RUN_TEST(test_temperature_cycle);
+    RUN_TEST(test_co2_level);
+    RUN_TEST(test_white_noise);
+    return UNITY_END();
+}
@@ -0,0 +1,98 @@
+#include <unity.h>
+#include <random>
+
+// Graph positions are private, the test reads them directly
+#define private public
+#include <classes/GraphingEngine.h>
+#undef private
+
+// Every cursor move restores the pixels it left from the plot model, so outside the cursor itself
+// the framebuffer has to stay equal to what was drawn before the cursor appeared
+
+static TwoWire wire(0, 0);
+static I2C_eeprom eeprom(0, 0, &wire);
+static SPIClass spi(0, 0, 0);
+static Adafruit_ILI9341 tft(&spi, 0, 0, 0);
+static uint16_t snapshot[TFT_YMAX][TFT_XMAX];
+
+typedef Graph<float, DATA_PNTS_AMT> graph_type;
+
+static bool isUnderCursor(graph_type& graph, int16_t x, int16_t y, bool dayscale) {
+    int16_t line_x = L_EDGE + graph._curr_index;
+    int16_t rect_y = graph._prev_values[graph._curr_index] + UP_EDGE - CRECT_HALF;
+    int16_t window_x = graph._cursor_x - (graph._window_width >> 1);
+
+    if (x == line_x && y >= UP_EDGE - CRECT_SIDE && y < BT_EDGE) return true;
+    if (x >= line_x - CRECT_HALF && x < line_x + CRECT_HALF && y >= rect_y && y < rect_y + CRECT_SIDE) return true;
+    if (x >= window_x && x < window_x + graph._window_width && y >= 5 && y < 35) return true;
+    // The data window is erased to black over the weekday labels and separator, annotate redraws them
+    return dayscale && y < 35;
+}
+
+static void checkCursorRestore(float base, float spread, bool dayscale, uint32_t seed) {
+    static DataVault<float, DATA_PNTS_AMT> vault;
+    static TimeColumn time;
+    std::mt19937 rng(seed);
+    vault.clearPoints();
+    for (uint16_t i = 0; i < DATA_PNTS_AMT; i++) {
+        vault.appendToAverage(base + (rng() % 1001) * spread / 1000);
+        vault.appendToVault();
+    }
+    time.restore(DATA_PNTS_AMT, 1600000000 + rng() % 10000000);
+    static graph_type graph(vault, time, eeprom, xSemaphoreCreateMutex(), HistorySpan{}, tft, spi);
+
+    graph.drawFresh();
+    graph.drawLocal();
+    graph.annotate(dayscale);
+    memcpy(snapshot, tft.frame, sizeof(snapshot));
+    graph.drawCursor(true);
+
+    for (uint16_t move = 0; move < 290; move++) {
+        int8_t step = (rng() % 2) ? CRSR_FAST : CRSR_SLOW;
+        graph.dynamicCursor((rng() % 2) ? step : -step);
+        for (int16_t y = 0; y < TFT_YMAX; y++) {
+            for (int16_t x = 0; x < TFT_XMAX; x++) {
+                if (isUnderCursor(graph, x, y, dayscale)) continue;
+                TEST_ASSERT_EQUAL_HEX16(snapshot[y][x], tft.frame[y][x]);
+            }
+        }
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_positive_dayscale() {
+    checkCursorRestore(15, 10, true, 1);
+}
+
+void test_positive_cursor() {
+    checkCursorRestore(15, 10, false, 2);
+}
+
+void test_negative_dayscale() {
+    checkCursorRestore(-25, 10, true, 3);
+}
+
+void test_negative_cursor() {
+    checkCursorRestore(-25, 10, false, 4);
+}
+
+void test_mixed_dayscale() {
+    checkCursorRestore(-8, 20, true, 5);
+}
+
+void test_mixed_cursor() {
+    checkCursorRestore(-8, 20, false, 6);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_positive_dayscale);
+    RUN_TEST(test_positive_cursor);
+    RUN_TEST(test_negative_dayscale);
+    RUN_TEST(test_negative_cursor);
+    RUN_TEST(test_mixed_dayscale);
+    RUN_TEST(test_mixed_cursor);
+    return UNITY_END();
+}
@@ -0,0 +1,96 @@
+#include <unity.h>
+#include <random>
+
+// Graph positions are private, the test reads them directly
+#define private public
+#include <classes/GraphingEngine.h>
+#undef private
+
+// Tick and weekday separator positions against the per-column timestamp scans they replaced
+
+static TwoWire wire(0, 0);
+static I2C_eeprom eeprom(0, 0, &wire);
+static SPIClass spi(0, 0, 0);
+static Adafruit_ILI9341 tft(&spi, 0, 0, 0);
+
+typedef Graph<float, DATA_PNTS_AMT> graph_type;
+
+static int16_t findScannedTick(graph_type& graph, uint8_t tick) {
+    for (uint16_t j = graph._curr_startp; j <= graph._curr_endp; j++) {
+        if (j == 0) continue;
+        Timestamp stamp = graph.findTimestamp(j);
+        if (stamp.hour == tick) {
+            int8_t diff = min((int8_t) stamp.minute, int8_t(60 - graph.findTimestamp(j - 1).minute));
+            return j - graph._curr_startp + L_EDGE - (diff != stamp.minute);
+        }
+    }
+    return -1;
+}
+
+static int16_t findScannedSeparator(graph_type& graph) {
+    for (uint16_t i = graph._curr_startp; i <= graph._curr_endp; i++) {
+        if (i == 0) continue;
+        if (graph.findTimestamp(i).weekday != graph.findTimestamp(i - 1).weekday) {
+            return i - graph._curr_startp + L_EDGE;
+        }
+    }
+    return L_EDGE;
+}
+
+static void checkLabels(graph_type& graph, size_t first_print) {
+    size_t next = first_print;
+    for (uint8_t i = 0; i * TICK_PER < 24; i++) {
+        int16_t x = graph._tick_posns[i];
+        if (x == -1 || x >= TFT_XMAX - 15) continue;
+
+        std::string hours = std::to_string(i * TICK_PER);
+        TEST_ASSERT_TRUE(next + 1 < tft.printed.size());
+        TEST_ASSERT_EQUAL_INT(x - 6 * (int16_t) hours.size() - 2, tft.printed[next].x);
+        TEST_ASSERT_TRUE(tft.printed[next].text == hours);
+        TEST_ASSERT_EQUAL_INT(x + 4, tft.printed[next + 1].x);
+        TEST_ASSERT_TRUE(tft.printed[next + 1].text == "00");
+        next += 2;
+    }
+    TEST_ASSERT_EQUAL_INT(tft.printed.size(), next);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_positions_match_scans() {
+    static DataVault<float, DATA_PNTS_AMT> vault;
+    static TimeColumn time;
+    for (uint16_t i = 0; i < DATA_PNTS_AMT; i++) {
+        vault.appendToAverage(20);
+        vault.appendToVault();
+    }
+    time.restore(DATA_PNTS_AMT, 0);
+    static graph_type graph(vault, time, eeprom, xSemaphoreCreateMutex(), HistorySpan{}, tft, spi);
+
+    std::mt19937 rng(3);
+    uint16_t two_digit_labels = 0;
+    for (uint16_t run = 0; run < 3000; run++) {
+        time.restore(DATA_PNTS_AMT, 1600000000 + rng() % 10000000);
+        graph._tier = RAW_TIER;
+        graph._curr_startp = (run % 50 == 0) ? 0 : rng() % (DATA_PNTS_AMT - (TFT_XMAX - L_EDGE) + 1);
+        graph._curr_endp = graph._curr_startp + TFT_XMAX - L_EDGE - 1;
+
+        tft.printed.clear();
+        graph.updateTicks(true);
+        for (uint8_t i = 0; i * TICK_PER < 24; i++) {
+            TEST_ASSERT_EQUAL_INT(findScannedTick(graph, i * TICK_PER), graph._tick_posns[i]);
+            if (i * TICK_PER >= 10 && graph._tick_posns[i] != -1) two_digit_labels++;
+        }
+        checkLabels(graph, 0);
+
+        graph.updateWeekdays(true);
+        TEST_ASSERT_EQUAL_INT(findScannedSeparator(graph), graph._separtr_index);
+    }
+    TEST_ASSERT_TRUE(two_digit_labels > 0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_positions_match_scans);
+    return UNITY_END();
+}
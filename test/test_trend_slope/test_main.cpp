@@ -0,0 +1,98 @@
+#include <unity.h>
+#include <random>
+
+#include <classes/DataVault.h>
+
+// The incremental regression sums are checked against a batch least-squares fit over the same stored points
+
+template <typename input_type, uint16_t capacity, typename storage>
+int8_t findBatchSlope(const DataVault<input_type, capacity, storage>& vault, float norm_range) {
+    uint16_t head_count = vault.getHeadCount();
+    uint16_t n = min(head_count, (uint16_t) TREND_PNTS_AMT);
+    if (n == 0) return 0;
+
+    double sum_x = 0, sum_y = 0, sum_xy = 0, sum_x2 = 0;
+    for (uint16_t x = 0; x < n; x++) {
+        double y = vault.getStoredValue(head_count - n + x);
+        sum_x += x;
+        sum_y += y;
+        sum_xy += x * y;
+        sum_x2 += (double) x * x;
+    }
+    double denominator = n * sum_x2 - sum_x * sum_x;
+    float slope = (denominator == 0) ? 0 : (n * sum_xy - sum_x * sum_y) / denominator;
+    slope /= APD_PER_S * storage::scale;
+    return constrain((float) 100 * (slope / norm_range), -100, 100);
+}
+
+template <typename vault_type, typename source_type>
+void checkRandomSeries(vault_type& vault, source_type next_value, float norm_range, uint32_t seed) {
+    std::mt19937 rng(seed);
+    uint32_t ties = 0;
+    for (uint16_t i = 0; i < 5 * vault.getCapacity(); i++) {
+        vault.appendToAverage(next_value(rng));
+        vault.appendToVault((rng() % 50 == 0) ? rng() % 4 : 0);
+
+        int8_t expected = findBatchSlope(vault, norm_range);
+        int8_t actual = vault.findNormalizedTrendSlope(norm_range);
+        // Float rounding may land a value on the other side of a truncation step
+        TEST_ASSERT_INT_WITHIN(1, expected, actual);
+        if (expected != actual) ties++;
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(vault.getCapacity() / 20, ties);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_scaled_temperature() {
+    static DataVault<float, 240> vault;
+    float value = 15;
+    checkRandomSeries(vault, [&](std::mt19937& rng) {
+        value += ((int) (rng() % 61) - 30) * 0.01f;
+        if (rng() % 200 == 0) value += ((int) (rng() % 21) - 10);
+        return value;
+    }, TEMP_NORM_RANGE, 1);
+}
+
+void test_scaled_humidity() {
+    static DataVault<float, 1200> vault;
+    float value = 60;
+    checkRandomSeries(vault, [&](std::mt19937& rng) {
+        value = constrain(value + ((int) (rng() % 41) - 20) * 0.1f, 0.0f, 100.0f);
+        return value;
+    }, HUM_NORM_RANGE, 2);
+}
+
+void test_compressed_pressure() {
+    static DataVault<float, 3 * DATA_PNTS_AMT, CompressedStorage<float>> vault;
+    float value = 755;
+    checkRandomSeries(vault, [&](std::mt19937& rng) {
+        value += ((int) (rng() % 7) - 3) * 0.05f;
+        return value;
+    }, PRESS_NORM_RANGE, 3);
+}
+
+void test_scaled_integer() {
+    static DataVault<uint16_t, 240> vault;
+    checkRandomSeries(vault, [](std::mt19937& rng) { return (uint16_t) (400 + rng() % 1600); }, 50, 4);
+}
+
+void test_plain_float() {
+    static DataVault<float, 240, PlainStorage<float>> vault;
+    float value = 0;
+    checkRandomSeries(vault, [&](std::mt19937& rng) {
+        value += ((int) (rng() % 2001) - 1000) * 0.0137f;
+        return value;
+    }, 1, 5);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_scaled_temperature);
+    RUN_TEST(test_scaled_humidity);
+    RUN_TEST(test_compressed_pressure);
+    RUN_TEST(test_scaled_integer);
+    RUN_TEST(test_plain_float);
+    return UNITY_END();
+}